@@ -8,6 +8,8 @@
 // ************************************************************************** //
 
 #include <mvvm/commands/commandservice.h>
+#include <mvvm/commands/contentappendcommand.h>
+#include <mvvm/commands/contentregioncommand.h>
 #include <mvvm/commands/copyitemcommand.h>
 #include <mvvm/commands/insertnewitemcommand.h>
 #include <mvvm/commands/moveitemcommand.h>
@@ -86,6 +88,25 @@ void CommandService::moveItem(SessionItem* item, SessionItem* new_parent, const
     process_command<MoveItemCommand>(item, new_parent, TagRow{tagrow.tag, actual_row});
 }
 
+void CommandService::appendContent(Data1DItem* item, const std::vector<double>& values)
+{
+    if (item->model() != m_model)
+        throw std::runtime_error(
+            "CommandService::appendContent() -> Item doesn't belong to given model");
+
+    process_command<ContentAppendCommand>(item, values);
+}
+
+void CommandService::setContentRegion(Data2DItem* item, int x0, int y0, int width, int height,
+                                      const std::vector<double>& values)
+{
+    if (item->model() != m_model)
+        throw std::runtime_error(
+            "CommandService::setContentRegion() -> Item doesn't belong to given model");
+
+    process_command<ContentRegionCommand>(item, Data2DItem::Region{x0, y0, width, height}, values);
+}
+
 QUndoStack* CommandService::undoStack() const
 {
     return m_commands.get();
@@ -15,6 +15,7 @@
 #include <mvvm/commands/commandadapter.h>
 #include <mvvm/core/export.h>
 #include <mvvm/model/function_types.h>
+#include <vector>
 
 class QUndoCommand;
 class QVariant;
@@ -25,6 +26,8 @@ namespace ModelView
 class SessionModel;
 class SessionItem;
 class TagRow;
+class Data1DItem;
+class Data2DItem;
 
 //! Provides undo/redo for all commands of SessionModel.
 
@@ -46,6 +49,11 @@ public:
 
     void moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow);
 
+    void appendContent(Data1DItem* item, const std::vector<double>& values);
+
+    void setContentRegion(Data2DItem* item, int x0, int y0, int width, int height,
+                          const std::vector<double>& values);
+
     QUndoStack* undoStack() const;
 
     void setCommandRecordPause(bool value);
@@ -0,0 +1,103 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/commands/contentappendcommand.h>
+#include <mvvm/model/path.h>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data1ditem.h>
+
+using namespace ModelView;
+
+struct ContentAppendCommand::ContentAppendCommandImpl {
+    std::vector<double> values; //! Values to append as a result of command execution.
+    double axis_max{0.0};       //! Upper limit of the axis before values were appended.
+    Path item_path;
+    ContentAppendCommandImpl(std::vector<double> values) : values(std::move(values)) {}
+};
+
+ContentAppendCommand::ContentAppendCommand(Data1DItem* item, std::vector<double> values)
+    : AbstractItemCommand(item),
+      p_impl(std::make_unique<ContentAppendCommandImpl>(std::move(values)))
+{
+    setDescription("Append content");
+    p_impl->item_path = pathFromItem(item);
+}
+
+ContentAppendCommand::~ContentAppendCommand() = default;
+
+//! Returns result of the command, values are always appended.
+
+ContentAppendCommand::result_t ContentAppendCommand::result() const
+{
+    return true;
+}
+
+//! Removes appended values and restores the axis. The axis is changed first without
+//! notification, so subscribers see the number of bins matching the content.
+
+void ContentAppendCommand::undo_command()
+{
+    auto item = data_item();
+    auto axis = item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
+    const int count = static_cast<int>(p_impl->values.size());
+    auto changed_items = set_axis(item, axis->size() - count, p_impl->axis_max);
+    item->remove_values(p_impl->values.size());
+    notify_data_change(changed_items);
+}
+
+//! Extends the axis by the number of appended values keeping the width of bins and appends
+//! values. For axis without bins, its range defines the width of the bin. The axis is changed
+//! first without notification, so subscribers see the number of bins matching the content.
+
+void ContentAppendCommand::execute_command()
+{
+    auto item = data_item();
+    auto axis = item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
+    const int nbins = axis->size();
+    const int new_nbins = nbins + static_cast<int>(p_impl->values.size());
+    auto [xmin, xmax] = axis->range();
+    const double step = nbins > 0 ? (xmax - xmin) / nbins : xmax - xmin;
+    p_impl->axis_max = xmax;
+    auto changed_items = set_axis(item, new_nbins, xmin + step * new_nbins);
+    item->append_values(p_impl->values);
+    notify_data_change(changed_items);
+}
+
+Data1DItem* ContentAppendCommand::data_item() const
+{
+    return static_cast<Data1DItem*>(itemFromPath(p_impl->item_path));
+}
+
+//! Sets the number of bins and the upper limit of the axis without notification. Returns property
+//! items whose data was changed.
+
+std::vector<SessionItem*> ContentAppendCommand::set_axis(Data1DItem* item, int nbins, double xmax)
+{
+    std::vector<SessionItem*> result;
+    auto set_value = [&result](SessionItem* property, const QVariant& value) {
+        auto variant = static_cast<const SessionItem*>(property)->storedData(ItemDataRole::DATA);
+        if (variant && *variant != value) {
+            *property->storedData(ItemDataRole::DATA) = value;
+            result.push_back(property);
+        }
+    };
+
+    auto axis = item->getItem(Data1DItem::T_AXIS);
+    set_value(axis->getItem(FixedBinAxisItem::P_NBINS), nbins);
+    set_value(axis->getItem(FixedBinAxisItem::P_MAX), xmax);
+    return result;
+}
+
+//! Notifies about data change of given items.
+
+void ContentAppendCommand::notify_data_change(const std::vector<SessionItem*>& items)
+{
+    for (auto property : items)
+        property->notifyDataChange(ItemDataRole::DATA);
+}
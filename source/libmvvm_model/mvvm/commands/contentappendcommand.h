@@ -0,0 +1,49 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_COMMANDS_CONTENTAPPENDCOMMAND_H
+#define MVVM_COMMANDS_CONTENTAPPENDCOMMAND_H
+
+#include <memory>
+#include <mvvm/commands/abstractitemcommand.h>
+#include <vector>
+
+namespace ModelView
+{
+
+class Data1DItem;
+class SessionItem;
+
+//! Command for undo/redo framework to append values to Data1DItem and to extend its fixed bin
+//! axis by the same number of bins. Only appended values are stored.
+
+class CORE_EXPORT ContentAppendCommand : public AbstractItemCommand
+{
+public:
+    using result_t = bool;
+
+    ContentAppendCommand(Data1DItem* item, std::vector<double> values);
+    ~ContentAppendCommand() override;
+
+    result_t result() const;
+
+private:
+    void undo_command() override;
+    void execute_command() override;
+    Data1DItem* data_item() const;
+    std::vector<SessionItem*> set_axis(Data1DItem* item, int nbins, double xmax);
+    void notify_data_change(const std::vector<SessionItem*>& items);
+
+    struct ContentAppendCommandImpl;
+    std::unique_ptr<ContentAppendCommandImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_COMMANDS_CONTENTAPPENDCOMMAND_H
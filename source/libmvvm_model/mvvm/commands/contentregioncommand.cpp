@@ -0,0 +1,57 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/commands/contentregioncommand.h>
+#include <mvvm/model/path.h>
+
+using namespace ModelView;
+
+struct ContentRegionCommand::ContentRegionCommandImpl {
+    Data2DItem::Region region;
+    std::vector<double> values; //! Values to set as a result of command execution.
+    Path item_path;
+    ContentRegionCommandImpl(Data2DItem::Region region, std::vector<double> values)
+        : region(region), values(std::move(values))
+    {
+    }
+};
+
+ContentRegionCommand::ContentRegionCommand(Data2DItem* item, Data2DItem::Region region,
+                                           std::vector<double> values)
+    : AbstractItemCommand(item),
+      p_impl(std::make_unique<ContentRegionCommandImpl>(region, std::move(values)))
+{
+    setDescription("Set content region");
+    p_impl->item_path = pathFromItem(item);
+}
+
+ContentRegionCommand::~ContentRegionCommand() = default;
+
+//! Returns result of the command, the region is always set.
+
+ContentRegionCommand::result_t ContentRegionCommand::result() const
+{
+    return true;
+}
+
+void ContentRegionCommand::undo_command()
+{
+    swap_values();
+}
+
+void ContentRegionCommand::execute_command()
+{
+    swap_values();
+}
+
+void ContentRegionCommand::swap_values()
+{
+    auto item = static_cast<Data2DItem*>(itemFromPath(p_impl->item_path));
+    item->swap_region(p_impl->region, p_impl->values);
+}
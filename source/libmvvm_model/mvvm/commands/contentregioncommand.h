@@ -0,0 +1,45 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_COMMANDS_CONTENTREGIONCOMMAND_H
+#define MVVM_COMMANDS_CONTENTREGIONCOMMAND_H
+
+#include <memory>
+#include <mvvm/commands/abstractitemcommand.h>
+#include <mvvm/standarditems/data2ditem.h>
+#include <vector>
+
+namespace ModelView
+{
+
+//! Command for undo/redo framework to set the values of the region of Data2DItem.
+//! Only values of the region are stored.
+
+class CORE_EXPORT ContentRegionCommand : public AbstractItemCommand
+{
+public:
+    using result_t = bool;
+
+    ContentRegionCommand(Data2DItem* item, Data2DItem::Region region, std::vector<double> values);
+    ~ContentRegionCommand() override;
+
+    result_t result() const;
+
+private:
+    void undo_command() override;
+    void execute_command() override;
+    void swap_values();
+
+    struct ContentRegionCommandImpl;
+    std::unique_ptr<ContentRegionCommandImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_COMMANDS_CONTENTREGIONCOMMAND_H
@@ -26,6 +26,7 @@ struct CopyItemCommand::CopyItemCommandImpl {
     TagRow tagrow;
     result_t result;
     std::unique_ptr<ItemBackupStrategy> backup_strategy;
+    std::unique_ptr<SessionItem> item_copy; //!< copy to insert on first execution
     Path item_path;
     CopyItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)), result(nullptr) {}
 };
@@ -38,9 +39,7 @@ CopyItemCommand::CopyItemCommand(const SessionItem* item, SessionItem* parent, T
     p_impl->item_path = pathFromItem(parent);
 
     auto copy_strategy = parent->model()->itemCopyStrategy(); // to modify id's
-    auto item_copy = copy_strategy->createCopy(item);
-
-    p_impl->backup_strategy->saveItem(item_copy.get());
+    p_impl->item_copy = copy_strategy->createCopy(item);
 }
 
 CopyItemCommand::~CopyItemCommand() = default;
@@ -48,14 +47,19 @@ CopyItemCommand::~CopyItemCommand() = default;
 void CopyItemCommand::undo_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
-    delete parent->takeItem(p_impl->tagrow);
+    auto item = std::unique_ptr<SessionItem>(parent->takeItem(p_impl->tagrow));
+    p_impl->backup_strategy->saveItem(item.get());
     p_impl->result = nullptr;
 }
 
+//! Inserts the copy made in constructor on first execution, and the copy restored from backup
+//! on subsequent redo.
+
 void CopyItemCommand::execute_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
-    auto item = p_impl->backup_strategy->restoreItem();
+    auto item = p_impl->item_copy ? std::move(p_impl->item_copy)
+                                  : p_impl->backup_strategy->restoreItem();
     if (parent->insertItem(item.get(), p_impl->tagrow)) {
         p_impl->result = item.release();
     } else {
@@ -26,6 +26,7 @@ void Comparators::registerComparators()
         QMetaType::registerComparators<ComboProperty>();
         QMetaType::registerComparators<ExternalProperty>();
         QMetaType::registerComparators<RealLimits>();
+        QMetaType::registerComparators<NumericArray>();
         m_is_registered = true;
     }
 }
@@ -31,12 +31,16 @@ bool Utils::CompatibleVariantTypes(const QVariant& oldValue, const QVariant& new
 {
     // Invalid variant can be rewritten by any variant.
     // Valid Variant can be replaced by invalid variant.
+    // Vector of doubles can be replaced by NumericArray, to upgrade the content of older projects.
     // In other cases types of variants should coincide to be compatible.
 
     if (!oldValue.isValid() || !newValue.isValid())
         return true;
 
-    return Utils::VariantType(oldValue) == Utils::VariantType(newValue);
+    if (Utils::VariantType(oldValue) == Utils::VariantType(newValue))
+        return true;
+
+    return IsDoubleVectorVariant(oldValue) && IsNumericArrayVariant(newValue);
 }
 
 bool Utils::IsTheSame(const QVariant& var1, const QVariant& var2)
@@ -45,6 +49,15 @@ bool Utils::IsTheSame(const QVariant& var1, const QVariant& var2)
     if (VariantType(var1) != VariantType(var2))
         return false;
 
+    // implicitly shared variants referring to the same value
+    if (var1.constData() == var2.constData())
+        return true;
+
+    // numeric arrays are the same only if they share the buffer, values are never compared
+    if (VariantType(var1) == qMetaTypeId<NumericArray>())
+        return static_cast<const NumericArray*>(var1.constData())
+            ->isSharedWith(*static_cast<const NumericArray*>(var2.constData()));
+
     // variants of same type are compared by value
     return var1 == var2;
 }
@@ -115,3 +128,8 @@ bool Utils::IsRealLimitsVariant(const QVariant& variant)
 {
     return variant.canConvert<RealLimits>();
 }
+
+bool Utils::IsNumericArrayVariant(const QVariant& variant)
+{
+    return variant.userType() == qMetaTypeId<NumericArray>();
+}
@@ -16,6 +16,7 @@
 #include <QMetaType>
 #include <QVariant>
 #include <mvvm/core/export.h>
+#include <mvvm/model/numericarray.h>
 #include <mvvm/utils/reallimits.h>
 #include <string>
 #include <vector>
@@ -70,11 +71,15 @@ CORE_EXPORT bool IsExtPropertyVariant(const QVariant& variant);
 //! Returns true in the case of RealLimits based variant.
 CORE_EXPORT bool IsRealLimitsVariant(const QVariant& variant);
 
+//! Returns true in the case of NumericArray based variant.
+CORE_EXPORT bool IsNumericArrayVariant(const QVariant& variant);
+
 } // namespace Utils
 } // namespace ModelView
 
 Q_DECLARE_METATYPE(std::string)
 Q_DECLARE_METATYPE(std::vector<double>)
 Q_DECLARE_METATYPE(ModelView::RealLimits)
+Q_DECLARE_METATYPE(ModelView::NumericArray)
 
 #endif // MVVM_MODEL_CUSTOMVARIANTS_H
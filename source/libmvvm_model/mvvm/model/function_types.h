@@ -18,6 +18,8 @@ namespace ModelView
 
 class SessionItem;
 using item_factory_func_t = std::function<std::unique_ptr<SessionItem>()>;
+using item_fetch_check_func_t = std::function<bool(const SessionItem*)>;
+using item_fetcher_func_t = std::function<void(SessionItem*)>;
 
 } // namespace ModelView
 
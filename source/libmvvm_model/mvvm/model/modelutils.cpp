@@ -41,3 +41,13 @@ void Utils::MoveDown(SessionItem* item)
         return; // item already at the buttom
     item->model()->moveItem(item, item->parent(), tagrow.next());
 }
+
+//! Loads the content of all top-level items which weren't loaded yet, when the model content is
+//! loaded lazily. Should be called before the model is serialized by other means.
+
+void Utils::FetchItems(SessionModel* model)
+{
+    // fetched items replace their placeholders, other top-level items stay in place
+    for (auto item : model->rootItem()->children())
+        model->fetchItem(item);
+}
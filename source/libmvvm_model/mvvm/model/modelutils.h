@@ -62,6 +62,7 @@ template <typename T = SessionItem> std::vector<T*> FindItems(const SessionModel
 void CORE_EXPORT DeleteItemFromModel(SessionItem* item);
 void CORE_EXPORT MoveUp(SessionItem* item);
 void CORE_EXPORT MoveDown(SessionItem* item);
+void CORE_EXPORT FetchItems(SessionModel* model);
 
 } // namespace Utils
 } // namespace ModelView
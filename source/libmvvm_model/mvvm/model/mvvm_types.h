@@ -42,6 +42,7 @@ const model_type VectorItemType = "Vector";
 const model_type LinkedItemType = "Linked";
 const model_type ViewportAxisItemType = "ViewportAxis";
 const model_type FixedBinAxisItemType = "FixedBinAxis";
+const model_type VariableBinAxisItemType = "VariableBinAxis";
 const model_type Data1DItemType = "Data1D";
 const model_type Data2DItemType = "Data2D";
 const model_type GraphItemType = "Graph";
@@ -0,0 +1,132 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <algorithm>
+#include <mvvm/model/numericarray.h>
+
+using namespace ModelView;
+
+NumericArray::NumericArray() : m_storage(empty_storage()) {}
+
+//! Constructs array of given type and size filled with zeros.
+
+NumericArray::NumericArray(ElementType type, size_t size)
+{
+    switch (type) {
+    case ElementType::FLOAT32:
+        m_storage = std::make_shared<storage_t>(std::vector<float>(size, 0.0f));
+        break;
+    case ElementType::FLOAT64:
+        m_storage = std::make_shared<storage_t>(std::vector<double>(size, 0.0));
+        break;
+    case ElementType::INT32:
+        m_storage = std::make_shared<storage_t>(std::vector<int32_t>(size, 0));
+        break;
+    }
+}
+
+NumericArray::NumericArray(std::vector<float> values)
+    : m_storage(std::make_shared<storage_t>(std::move(values)))
+{
+}
+
+NumericArray::NumericArray(std::vector<double> values)
+    : m_storage(std::make_shared<storage_t>(std::move(values)))
+{
+}
+
+NumericArray::NumericArray(std::vector<int32_t> values)
+    : m_storage(std::make_shared<storage_t>(std::move(values)))
+{
+}
+
+NumericArray::NumericArray(NumericArray&& other) noexcept : m_storage(std::move(other.m_storage))
+{
+    other.m_storage = empty_storage();
+}
+
+NumericArray& NumericArray::operator=(NumericArray&& other) noexcept
+{
+    if (this != &other) {
+        m_storage = std::move(other.m_storage);
+        other.m_storage = empty_storage();
+    }
+    return *this;
+}
+
+NumericArray::ElementType NumericArray::elementType() const
+{
+    return static_cast<ElementType>(m_storage->index());
+}
+
+size_t NumericArray::size() const
+{
+    return std::visit([](const auto& values) { return values.size(); }, *m_storage);
+}
+
+bool NumericArray::empty() const
+{
+    return size() == 0;
+}
+
+//! Returns value with given index converted to double.
+
+double NumericArray::value(size_t index) const
+{
+    return std::visit([index](const auto& values) { return static_cast<double>(values[index]); },
+                      *m_storage);
+}
+
+//! Returns copy of all values converted to double.
+
+std::vector<double> NumericArray::toDoubles() const
+{
+    return std::visit(
+        [](const auto& values) { return std::vector<double>(values.begin(), values.end()); },
+        *m_storage);
+}
+
+//! Returns true if both arrays refer to the same buffer.
+
+bool NumericArray::isSharedWith(const NumericArray& other) const
+{
+    return m_storage == other.m_storage;
+}
+
+bool NumericArray::operator==(const NumericArray& other) const
+{
+    return isSharedWith(other) || *m_storage == *other.m_storage;
+}
+
+bool NumericArray::operator!=(const NumericArray& other) const
+{
+    return !(*this == other);
+}
+
+bool NumericArray::operator<(const NumericArray& other) const
+{
+    return !isSharedWith(other) && *m_storage < *other.m_storage;
+}
+
+//! Returns empty float64 buffer shared by all empty arrays, it is detached on modification as any
+//! other shared buffer.
+
+std::shared_ptr<NumericArray::storage_t> NumericArray::empty_storage()
+{
+    static const auto storage = std::make_shared<storage_t>(std::vector<double>());
+    return storage;
+}
+
+//! Makes the buffer unique for this array, copying it if it is shared.
+
+void NumericArray::detach()
+{
+    if (m_storage.use_count() > 1)
+        m_storage = std::make_shared<storage_t>(*m_storage);
+}
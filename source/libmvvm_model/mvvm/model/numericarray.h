@@ -0,0 +1,99 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_NUMERICARRAY_H
+#define MVVM_MODEL_NUMERICARRAY_H
+
+#include <cstdint>
+#include <memory>
+#include <mvvm/core/export.h>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+namespace ModelView
+{
+
+/*!
+@class NumericArray
+@brief Array of float32, float64 or int32 numbers with shared copy-on-write buffer.
+
+Copies of the array share the same buffer, which is detached on the first modification via
+mutableValues(). Arrays sharing the buffer are equal without comparison of values. Moved-from
+array is left empty with float64 element type. Intended for large numeric data stored in
+SessionItem, where reading the data and comparing the old and new values in setData don't touch
+the buffer.
+*/
+
+class CORE_EXPORT NumericArray
+{
+public:
+    enum class ElementType { FLOAT32, FLOAT64, INT32 };
+
+    NumericArray();
+    NumericArray(ElementType type, size_t size);
+    NumericArray(const NumericArray& other) = default;
+    NumericArray(NumericArray&& other) noexcept;
+    NumericArray& operator=(const NumericArray& other) = default;
+    NumericArray& operator=(NumericArray&& other) noexcept;
+    explicit NumericArray(std::vector<float> values);
+    explicit NumericArray(std::vector<double> values);
+    explicit NumericArray(std::vector<int32_t> values);
+
+    ElementType elementType() const;
+
+    size_t size() const;
+
+    bool empty() const;
+
+    template <typename T> const std::vector<T>& values() const;
+
+    template <typename T> std::vector<T>& mutableValues();
+
+    double value(size_t index) const;
+
+    std::vector<double> toDoubles() const;
+
+    bool isSharedWith(const NumericArray& other) const;
+
+    bool operator==(const NumericArray& other) const;
+    bool operator!=(const NumericArray& other) const;
+    bool operator<(const NumericArray& other) const;
+
+private:
+    using storage_t = std::variant<std::vector<float>, std::vector<double>, std::vector<int32_t>>;
+    static std::shared_ptr<storage_t> empty_storage();
+    void detach();
+
+    std::shared_ptr<storage_t> m_storage;
+};
+
+//! Returns values of the given element type without copying them. Throws if the type doesn't
+//! match. Reference stays valid until the array is modified.
+
+template <typename T> const std::vector<T>& NumericArray::values() const
+{
+    if (auto result = std::get_if<std::vector<T>>(m_storage.get()); result)
+        return *result;
+    throw std::runtime_error("NumericArray::values() -> Element type mismatch");
+}
+
+//! Returns values of the given element type for modification. The buffer is copied first, if it
+//! is shared with other arrays. Throws if the type doesn't match.
+
+template <typename T> std::vector<T>& NumericArray::mutableValues()
+{
+    values<T>(); // checks the type before the buffer is copied
+    detach();
+    return std::get<std::vector<T>>(*m_storage);
+}
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_NUMERICARRAY_H
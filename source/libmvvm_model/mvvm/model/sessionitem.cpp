@@ -37,6 +37,7 @@ struct SessionItem::SessionItemImpl {
     std::unique_ptr<SessionItemData> m_data;
     std::unique_ptr<SessionItemTags> m_tags;
     model_type m_modelType;
+    int m_data_revision{0}; //!< incremented on every data change
 
     SessionItemImpl()
         : m_data(std::make_unique<SessionItemData>()), m_tags(std::make_unique<SessionItemTags>())
@@ -312,6 +313,33 @@ void SessionItem::setAppearanceFlag(int flag, bool value)
     setDataIntern(flags, ItemDataRole::APPEARANCE);
 }
 
+//! Returns the counter of data changes. It can be used by derived items and by views to
+//! invalidate caches of values calculated from the data.
+
+int SessionItem::dataRevision() const
+{
+    return p_impl->m_data_revision;
+}
+
+const QVariant* SessionItem::storedData(int role) const
+{
+    return p_impl->m_data->storedData(role);
+}
+
+//! Returns stored variant for in-place modification, the data is considered as changed.
+
+QVariant* SessionItem::storedData(int role)
+{
+    ++p_impl->m_data_revision;
+    return p_impl->m_data->storedData(role);
+}
+
+void SessionItem::notifyDataChange(int role)
+{
+    if (p_impl->m_model)
+        p_impl->m_model->mapper()->callOnDataChange(this, role);
+}
+
 SessionItemData* SessionItem::itemData() const
 {
     return p_impl->m_data.get();
@@ -327,11 +355,14 @@ void SessionItem::setDataAndTags(std::unique_ptr<SessionItemData> data,
 {
     p_impl->m_data = std::move(data);
     p_impl->m_tags = std::move(tags);
+    ++p_impl->m_data_revision;
 }
 
 bool SessionItem::setDataIntern(const QVariant& variant, int role)
 {
     bool result = p_impl->m_data->setData(variant, role);
+    if (result)
+        ++p_impl->m_data_revision;
     if (result && p_impl->m_model)
         p_impl->m_model->mapper()->callOnDataChange(this, role);
     return result;
@@ -11,6 +11,7 @@
 #define MVVM_MODEL_SESSIONITEM_H
 
 #include <QVariant>
+#include <functional>
 #include <memory>
 #include <mvvm/core/export.h>
 #include <mvvm/model/mvvm_types.h>
@@ -44,6 +45,8 @@ public:
 
     QVariant data(int role = ItemDataRole::DATA) const;
 
+    int dataRevision() const;
+
     SessionModel* model() const;
 
     SessionItem* parent() const;
@@ -89,13 +92,24 @@ public:
 
     void setProperty(const std::string& tag, const QVariant& variant);
 
+protected:
+    template <typename T> const T* dataPtr(int role = ItemDataRole::DATA) const;
+    template <typename T>
+    bool updateData(const std::function<void(T&)>& func, int role = ItemDataRole::DATA);
+
 private:
     friend class SessionModel;
     friend class JsonItemConverter;
+    friend class DirectItemCopyStrategy;
+    friend class BinaryItemBackupStrategy;
+    friend class ContentAppendCommand;
     virtual void activate() {}
     void setParent(SessionItem* parent);
     void setModel(SessionModel* model);
     void setAppearanceFlag(int flag, bool value);
+    const QVariant* storedData(int role) const;
+    QVariant* storedData(int role);
+    void notifyDataChange(int role);
 
     // FIXME refactor converter access to item internals
     class SessionItemData* itemData() const;
@@ -134,6 +148,33 @@ template <typename T = SessionItem> std::vector<T*> SessionItem::items(const std
     return result;
 }
 
+//! Returns pointer to the value of given type stored for given role, without copying it.
+//! Pointer stays valid until the next data change. Returns nullptr if there is no such value.
+
+template <typename T> const T* SessionItem::dataPtr(int role) const
+{
+    auto variant = storedData(role);
+    return variant && variant->userType() == qMetaTypeId<T>()
+               ? static_cast<const T*>(variant->constData())
+               : nullptr;
+}
+
+//! Modifies the value of given type stored for given role in place and notifies about data change.
+//! Value is detached first, if it is shared with other variants. Returns false if there is no such
+//! value. Modification bypasses undo/redo framework.
+
+template <typename T>
+bool SessionItem::updateData(const std::function<void(T&)>& func, int role)
+{
+    auto variant = storedData(role);
+    if (!variant || variant->userType() != qMetaTypeId<T>())
+        return false;
+
+    func(*static_cast<T*>(variant->data()));
+    notifyDataChange(role);
+    return true;
+}
+
 } // namespace ModelView
 
 #endif // MVVM_MODEL_SESSIONITEM_H
@@ -30,6 +30,25 @@ QVariant SessionItemData::data(int role) const
     return QVariant();
 }
 
+//! Returns pointer to the variant stored for given role, or nullptr if role doesn't exist.
+//! Pointer stays valid until the next data change.
+
+const QVariant* SessionItemData::storedData(int role) const
+{
+    for (const auto& value : m_values) {
+        if (value.m_role == role)
+            return &value.m_data;
+    }
+    return nullptr;
+}
+
+//! Returns pointer to the variant stored for given role to modify it in place.
+
+QVariant* SessionItemData::storedData(int role)
+{
+    return const_cast<QVariant*>(static_cast<const SessionItemData*>(this)->storedData(role));
+}
+
 //! Sets the data for given role. Returns true if data was changed.
 //! If variant is invalid, corresponding role will be removed.
 
@@ -67,13 +86,15 @@ SessionItemData::const_iterator SessionItemData::end() const
 
 void SessionItemData::assure_validity(const QVariant& variant, int role)
 {
-    if (variant.typeName() == QStringLiteral("QString"))
+    if (variant.userType() == QMetaType::QString)
         throw std::runtime_error("Attempt to set QString based variant");
 
-    if (!Utils::CompatibleVariantTypes(data(role), variant)) {
+    // types are compared by their id, stored variant isn't copied
+    auto stored = storedData(role);
+    if (stored && !Utils::CompatibleVariantTypes(*stored, variant)) {
         std::ostringstream ostr;
         ostr << "SessionItemData::assure_validity() -> Error. Variant types mismatch. "
-             << "Old variant type '" << data(role).typeName() << "' "
+             << "Old variant type '" << stored->typeName() << "' "
              << "new variant type '" << variant.typeName() << "\n";
         throw std::runtime_error(ostr.str());
     }
@@ -29,6 +29,9 @@ public:
 
     QVariant data(int role) const;
 
+    const QVariant* storedData(int role) const;
+    QVariant* storedData(int role);
+
     bool setData(const QVariant& value, int role);
 
     const_iterator begin() const;
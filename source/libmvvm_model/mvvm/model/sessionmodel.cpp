@@ -18,8 +18,8 @@
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/model/taginfo.h>
 #include <mvvm/model/tagrow.h>
-#include <mvvm/serialization/jsonitembackupstrategy.h>
-#include <mvvm/serialization/jsonitemcopystrategy.h>
+#include <mvvm/serialization/binaryitembackupstrategy.h>
+#include <mvvm/serialization/directitemcopystrategy.h>
 #include <mvvm/signals/modelmapper.h>
 #include <mvvm/standarditems/standarditemcatalogue.h>
 
@@ -66,11 +66,14 @@ SessionItem* SessionModel::insertNewItem(const model_type& modelType, SessionIte
 }
 
 //! Copy item and insert it in parent's tag and row.
-//! Item could belong to any model/parent.
+//! Item could belong to any model/parent, its content should be loaded.
 
 SessionItem* SessionModel::copyItem(const SessionItem* item, SessionItem* parent,
                                     const TagRow& tagrow)
 {
+    if (item && item->model() && item->model()->canFetchItem(item))
+        throw std::runtime_error("SessionModel::copyItem() -> Error. Item isn't loaded yet.");
+
     return m_commands->copyItem(item, parent, tagrow);
 }
 
@@ -140,6 +143,23 @@ void SessionModel::moveItem(SessionItem* item, SessionItem* new_parent, const Ta
     m_commands->moveItem(item, new_parent, tagrow);
 }
 
+//! Appends values to the content of Data1DItem, see Data1DItem::appendContent().
+//! Undo/redo, if enabled, stores only the appended values.
+
+void SessionModel::appendContent(Data1DItem* item, const std::vector<double>& values)
+{
+    m_commands->appendContent(item, values);
+}
+
+//! Sets values of the rectangular region of bins of Data2DItem, see Data2DItem::setContentRegion().
+//! Undo/redo, if enabled, stores only the values of the region.
+
+void SessionModel::setContentRegion(Data2DItem* item, int x0, int y0, int width, int height,
+                                    const std::vector<double>& values)
+{
+    m_commands->setContentRegion(item, x0, y0, width, height, values);
+}
+
 void SessionModel::register_item(SessionItem* item)
 {
     m_item_manager->register_item(item);
@@ -165,19 +185,20 @@ void SessionModel::clear()
 }
 
 //! Returns strategy suitable for saving/restoring SessionItem.
-//! Restored item will have same identifiers as original.
+//! Restored item will have same identifiers as original. Content is kept in compact binary form.
 
 std::unique_ptr<ItemBackupStrategy> SessionModel::itemBackupStrategy() const
 {
-    return std::make_unique<JsonItemBackupStrategy>(factory());
+    return std::make_unique<BinaryItemBackupStrategy>(factory());
 }
 
 //! Returns strategy for copying items.
 //! Identifiers of the copy will be different from identifiers of the original.
+//! Items are cloned directly in memory, without intermediate json representation.
 
 std::unique_ptr<ItemCopyStrategy> SessionModel::itemCopyStrategy() const
 {
-    return std::make_unique<JsonItemCopyStrategy>(factory());
+    return std::make_unique<DirectItemCopyStrategy>(factory());
 }
 
 //! Returns pointer to ItemFactory which can generate all items supported by this model,
@@ -188,12 +209,39 @@ const ItemFactoryInterface* SessionModel::factory() const
 }
 
 //!  Returns SessionItem for given identifier.
+//!  If the model content is loaded lazily, top-level item which isn't loaded yet is returned as
+//!  a placeholder, and its descendants are not found until it is loaded with fetchItem().
 
 SessionItem* SessionModel::findItem(identifier_type id)
 {
     return m_item_manager->findItem(id);
 }
 
+//! Sets functions to load the content of items on demand, when model content is loaded lazily.
+//! Loading is triggered by views on fetchItem request, items are never loaded on lookup.
+
+void SessionModel::setItemFetcher(item_fetch_check_func_t can_fetch, item_fetcher_func_t fetcher)
+{
+    m_can_fetch_item = std::move(can_fetch);
+    m_item_fetcher = std::move(fetcher);
+}
+
+//! Returns true if the content of given item isn't loaded yet and can be loaded on demand.
+
+bool SessionModel::canFetchItem(const SessionItem* item) const
+{
+    return m_can_fetch_item && m_can_fetch_item(item);
+}
+
+//! Loads the content of given item. The item can be replaced in the model with the loaded one,
+//! so the pointer shouldn't be used after the call.
+
+void SessionModel::fetchItem(SessionItem* item)
+{
+    if (m_item_fetcher && canFetchItem(item))
+        m_item_fetcher(item);
+}
+
 //! Creates root item.
 
 void SessionModel::createRootItem()
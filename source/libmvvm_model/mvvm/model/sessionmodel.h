@@ -18,6 +18,7 @@
 #include <mvvm/model/path.h>
 #include <mvvm/model/tagrow.h>
 #include <string>
+#include <vector>
 
 class QUndoStack;
 
@@ -33,6 +34,8 @@ class ItemPool;
 class ItemBackupStrategy;
 class ItemFactoryInterface;
 class ItemCopyStrategy;
+class Data1DItem;
+class Data2DItem;
 
 class CORE_EXPORT SessionModel
 {
@@ -70,6 +73,11 @@ public:
 
     void moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow);
 
+    void appendContent(Data1DItem* item, const std::vector<double>& values);
+
+    void setContentRegion(Data2DItem* item, int x0, int y0, int width, int height,
+                          const std::vector<double>& values);
+
     void register_item(SessionItem* item);
     void unregister_item(SessionItem* item);
 
@@ -85,6 +93,12 @@ public:
 
     SessionItem* findItem(identifier_type id);
 
+    void setItemFetcher(item_fetch_check_func_t can_fetch, item_fetcher_func_t fetcher);
+
+    bool canFetchItem(const SessionItem* item) const;
+
+    void fetchItem(SessionItem* item);
+
 protected:
     std::unique_ptr<ItemManager> m_item_manager;
 
@@ -96,6 +110,8 @@ private:
     std::string m_model_type;
     std::unique_ptr<ModelMapper> m_mapper;
     std::unique_ptr<SessionItem> m_root_item;
+    item_fetch_check_func_t m_can_fetch_item;
+    item_fetcher_func_t m_item_fetcher;
 };
 
 template <typename T> T* SessionModel::insertItem(SessionItem* parent, const TagRow& tagrow)
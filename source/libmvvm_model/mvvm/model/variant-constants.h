@@ -30,6 +30,7 @@ const std::string comboproperty_type_name = "ModelView::ComboProperty";
 const std::string qcolor_type_name = "QColor";
 const std::string extproperty_type_name = "ModelView::ExternalProperty";
 const std::string reallimits_type_name = "ModelView::RealLimits";
+const std::string numericarray_type_name = "ModelView::NumericArray";
 
 } // namespace Constants
 
@@ -0,0 +1,382 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QByteArray>
+#include <QColor>
+#include <QDataStream>
+#include <algorithm>
+#include <iterator>
+#include <mvvm/model/comboproperty.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/externalproperty.h>
+#include <mvvm/model/itemfactoryinterface.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionitemcontainer.h>
+#include <mvvm/model/sessionitemdata.h>
+#include <mvvm/model/sessionitemtags.h>
+#include <mvvm/serialization/binaryitembackupstrategy.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+
+//! Numeric arrays longer than this will be compressed, if compression is enabled.
+const size_t compression_threshold = 1024;
+
+//! Markers of variant types in the binary stream.
+enum VariantMarker : quint8 {
+    INVALID,
+    BOOL,
+    INT,
+    STRING,
+    DOUBLE,
+    VECTOR_DOUBLE,
+    COMBOPROPERTY,
+    COLOR,
+    EXTPROPERTY,
+    REALLIMITS,
+    NUMERICARRAY
+};
+
+void write_string(QDataStream& stream, const std::string& str);
+std::string read_string(QDataStream& stream);
+
+void write_strings(QDataStream& stream, const std::vector<std::string>& strings);
+std::vector<std::string> read_strings(QDataStream& stream);
+
+template <typename T>
+void write_values(QDataStream& stream, const std::vector<T>& values, bool compress);
+template <typename T> std::vector<T> read_values(QDataStream& stream);
+
+void write_array(QDataStream& stream, const NumericArray& array, bool compress);
+NumericArray read_array(QDataStream& stream);
+
+void write_variant(QDataStream& stream, const QVariant& variant, bool compress);
+QVariant read_variant(QDataStream& stream);
+
+} // namespace
+
+struct BinaryItemBackupStrategy::BinaryItemBackupStrategyImpl {
+    const ItemFactoryInterface* m_factory{nullptr};
+    bool m_compress{false};
+    QByteArray m_buffer;
+};
+
+//! Constructor of binary backup strategy.
+//! @param item_factory: SessionItem factory.
+//! @param compress: compress large arrays of doubles to reduce the memory footprint of backup.
+
+BinaryItemBackupStrategy::BinaryItemBackupStrategy(const ItemFactoryInterface* item_factory,
+                                                   bool compress)
+    : p_impl(std::make_unique<BinaryItemBackupStrategyImpl>())
+{
+    p_impl->m_factory = item_factory;
+    p_impl->m_compress = compress;
+}
+
+BinaryItemBackupStrategy::~BinaryItemBackupStrategy() = default;
+
+std::unique_ptr<SessionItem> BinaryItemBackupStrategy::restoreItem() const
+{
+    if (p_impl->m_buffer.isEmpty())
+        return {};
+
+    QDataStream stream(p_impl->m_buffer);
+    auto result = read_item(stream);
+    if (stream.status() != QDataStream::Ok)
+        throw std::runtime_error(
+            "BinaryItemBackupStrategy::restoreItem() -> Error. Corrupted backup buffer.");
+    return result;
+}
+
+void BinaryItemBackupStrategy::saveItem(const SessionItem* item)
+{
+    p_impl->m_buffer.clear();
+    if (!item)
+        return;
+
+    QDataStream stream(&p_impl->m_buffer, QIODevice::WriteOnly);
+    write_item(stream, *item);
+}
+
+void BinaryItemBackupStrategy::write_item(QDataStream& stream, const SessionItem& item) const
+{
+    write_string(stream, item.modelType());
+
+    const auto data = item.itemData();
+    stream << static_cast<quint32>(std::distance(data->begin(), data->end()));
+    for (const auto& x : *data) {
+        stream << static_cast<qint32>(x.m_role);
+        write_variant(stream, x.m_data, p_impl->m_compress);
+    }
+
+    const auto tags = item.itemTags();
+    write_string(stream, tags->defaultTag());
+    stream << static_cast<quint32>(std::distance(tags->begin(), tags->end()));
+    for (auto container : *tags) {
+        const auto tagInfo = container->tagInfo();
+        write_string(stream, tagInfo.name());
+        stream << static_cast<qint32>(tagInfo.min()) << static_cast<qint32>(tagInfo.max());
+        write_strings(stream, tagInfo.modelTypes());
+        stream << static_cast<quint32>(container->itemCount());
+        for (auto child : *container)
+            write_item(stream, *child);
+    }
+}
+
+std::unique_ptr<SessionItem> BinaryItemBackupStrategy::read_item(QDataStream& stream,
+                                                                 SessionItem* parent) const
+{
+    auto result = p_impl->m_factory->createItem(read_string(stream));
+    result->setParent(parent);
+
+    auto data = std::make_unique<SessionItemData>();
+    quint32 role_count{0};
+    stream >> role_count;
+    for (quint32 i = 0; i < role_count; ++i) {
+        qint32 role{0};
+        stream >> role;
+        data->setData(read_variant(stream), role);
+    }
+
+    auto tags = std::make_unique<SessionItemTags>();
+    tags->setDefaultTag(read_string(stream));
+    quint32 container_count{0};
+    stream >> container_count;
+    for (quint32 i = 0; i < container_count; ++i) {
+        auto name = read_string(stream);
+        qint32 min{0}, max{0};
+        stream >> min >> max;
+        TagInfo tagInfo(name, min, max, read_strings(stream));
+        tags->registerTag(tagInfo);
+        quint32 item_count{0};
+        stream >> item_count;
+        for (quint32 row = 0; row < item_count; ++row)
+            tags->insertItem(read_item(stream, result.get()).release(), TagRow::append(name));
+    }
+
+    result->setDataAndTags(std::move(data), std::move(tags));
+    return result;
+}
+
+namespace
+{
+
+void write_string(QDataStream& stream, const std::string& str)
+{
+    stream << QByteArray::fromStdString(str);
+}
+
+std::string read_string(QDataStream& stream)
+{
+    QByteArray result;
+    stream >> result;
+    return result.toStdString();
+}
+
+void write_strings(QDataStream& stream, const std::vector<std::string>& strings)
+{
+    stream << static_cast<quint32>(strings.size());
+    for (const auto& str : strings)
+        write_string(stream, str);
+}
+
+std::vector<std::string> read_strings(QDataStream& stream)
+{
+    quint32 size{0};
+    stream >> size;
+    std::vector<std::string> result;
+    for (quint32 i = 0; i < size; ++i)
+        result.push_back(read_string(stream));
+    return result;
+}
+
+//! Writes raw bytes of array of numbers, optionally compressed.
+
+template <typename T>
+void write_values(QDataStream& stream, const std::vector<T>& values, bool compress)
+{
+    const int nbytes = static_cast<int>(values.size() * sizeof(T));
+    const bool is_compressed = compress && values.size() > compression_threshold;
+    stream << static_cast<quint32>(values.size()) << is_compressed;
+    if (is_compressed) {
+        stream << qCompress(reinterpret_cast<const uchar*>(values.data()), nbytes, 1);
+    } else {
+        stream.writeRawData(reinterpret_cast<const char*>(values.data()), nbytes);
+    }
+}
+
+template <typename T> std::vector<T> read_values(QDataStream& stream)
+{
+    quint32 size{0};
+    bool is_compressed{false};
+    stream >> size >> is_compressed;
+    std::vector<T> result(size);
+    const int nbytes = static_cast<int>(size * sizeof(T));
+    if (is_compressed) {
+        QByteArray compressed;
+        stream >> compressed;
+        auto raw = qUncompress(compressed);
+        if (raw.size() != nbytes)
+            throw std::runtime_error("BinaryItemBackupStrategy -> Error. Corrupted array.");
+        std::copy(raw.constData(), raw.constData() + nbytes,
+                  reinterpret_cast<char*>(result.data()));
+    } else {
+        stream.readRawData(reinterpret_cast<char*>(result.data()), nbytes);
+    }
+    return result;
+}
+
+//! Writes element type and raw bytes of numeric array.
+
+void write_array(QDataStream& stream, const NumericArray& array, bool compress)
+{
+    stream << static_cast<quint8>(array.elementType());
+    switch (array.elementType()) {
+    case NumericArray::ElementType::FLOAT32:
+        write_values(stream, array.values<float>(), compress);
+        break;
+    case NumericArray::ElementType::FLOAT64:
+        write_values(stream, array.values<double>(), compress);
+        break;
+    case NumericArray::ElementType::INT32:
+        write_values(stream, array.values<int32_t>(), compress);
+        break;
+    }
+}
+
+NumericArray read_array(QDataStream& stream)
+{
+    quint8 type{0};
+    stream >> type;
+    switch (static_cast<NumericArray::ElementType>(type)) {
+    case NumericArray::ElementType::FLOAT32:
+        return NumericArray(read_values<float>(stream));
+    case NumericArray::ElementType::FLOAT64:
+        return NumericArray(read_values<double>(stream));
+    case NumericArray::ElementType::INT32:
+        return NumericArray(read_values<int32_t>(stream));
+    }
+    throw std::runtime_error("BinaryItemBackupStrategy -> Error. Unknown element type of array.");
+}
+
+void write_variant(QDataStream& stream, const QVariant& variant, bool compress)
+{
+    const int type = Utils::VariantType(variant);
+
+    if (type == QMetaType::UnknownType) {
+        stream << static_cast<quint8>(INVALID);
+    } else if (type == QMetaType::Bool) {
+        stream << static_cast<quint8>(BOOL) << variant.value<bool>();
+    } else if (type == QMetaType::Int) {
+        stream << static_cast<quint8>(INT) << static_cast<qint32>(variant.value<int>());
+    } else if (type == qMetaTypeId<std::string>()) {
+        stream << static_cast<quint8>(STRING);
+        write_string(stream, variant.value<std::string>());
+    } else if (type == QMetaType::Double) {
+        stream << static_cast<quint8>(DOUBLE) << variant.value<double>();
+    } else if (type == qMetaTypeId<std::vector<double>>()) {
+        stream << static_cast<quint8>(VECTOR_DOUBLE);
+        write_values(stream, *static_cast<const std::vector<double>*>(variant.constData()),
+                     compress);
+    } else if (type == qMetaTypeId<ComboProperty>()) {
+        auto combo = variant.value<ComboProperty>();
+        stream << static_cast<quint8>(COMBOPROPERTY);
+        write_strings(stream, combo.values());
+        write_strings(stream, combo.toolTips());
+        write_string(stream, combo.stringOfSelections());
+    } else if (type == QMetaType::QColor) {
+        stream << static_cast<quint8>(COLOR) << variant.value<QColor>();
+    } else if (type == qMetaTypeId<ExternalProperty>()) {
+        auto extprop = variant.value<ExternalProperty>();
+        stream << static_cast<quint8>(EXTPROPERTY);
+        write_string(stream, extprop.text());
+        stream << extprop.color();
+        write_string(stream, extprop.identifier());
+    } else if (type == qMetaTypeId<RealLimits>()) {
+        auto limits = variant.value<RealLimits>();
+        stream << static_cast<quint8>(REALLIMITS) << limits.hasLowerLimit()
+               << limits.hasUpperLimit() << limits.lowerLimit() << limits.upperLimit();
+    } else if (type == qMetaTypeId<NumericArray>()) {
+        stream << static_cast<quint8>(NUMERICARRAY);
+        write_array(stream, *static_cast<const NumericArray*>(variant.constData()), compress);
+    } else {
+        throw std::runtime_error("BinaryItemBackupStrategy -> Error. Unknown variant type '"
+                                 + Utils::VariantName(variant) + "'.");
+    }
+}
+
+QVariant read_variant(QDataStream& stream)
+{
+    quint8 marker{INVALID};
+    stream >> marker;
+
+    switch (marker) {
+    case INVALID:
+        return QVariant();
+    case BOOL: {
+        bool value{false};
+        stream >> value;
+        return QVariant::fromValue(value);
+    }
+    case INT: {
+        qint32 value{0};
+        stream >> value;
+        return QVariant::fromValue(static_cast<int>(value));
+    }
+    case STRING:
+        return QVariant::fromValue(read_string(stream));
+    case DOUBLE: {
+        double value{0.0};
+        stream >> value;
+        return QVariant::fromValue(value);
+    }
+    case VECTOR_DOUBLE:
+        return QVariant::fromValue(read_values<double>(stream));
+    case COMBOPROPERTY: {
+        ComboProperty combo;
+        combo.setValues(read_strings(stream));
+        combo.setToolTips(read_strings(stream));
+        combo.setStringOfSelections(read_string(stream));
+        return combo.variant();
+    }
+    case COLOR: {
+        QColor color;
+        stream >> color;
+        return QVariant::fromValue(color);
+    }
+    case EXTPROPERTY: {
+        auto text = read_string(stream);
+        QColor color;
+        stream >> color;
+        auto identifier = read_string(stream);
+        return QVariant::fromValue(ExternalProperty(text, color, identifier));
+    }
+    case REALLIMITS: {
+        bool has_lower{false}, has_upper{false};
+        double lower{0.0}, upper{0.0};
+        stream >> has_lower >> has_upper >> lower >> upper;
+        if (has_lower && has_upper)
+            return QVariant::fromValue(RealLimits::limited(lower, upper));
+        if (has_lower)
+            return QVariant::fromValue(RealLimits::lowerLimited(lower));
+        if (has_upper)
+            return QVariant::fromValue(RealLimits::upperLimited(upper));
+        return QVariant::fromValue(RealLimits::limitless());
+    }
+    case NUMERICARRAY:
+        return QVariant::fromValue(read_array(stream));
+    default:
+        throw std::runtime_error("BinaryItemBackupStrategy -> Error. Unknown variant marker.");
+    }
+}
+
+} // namespace
@@ -0,0 +1,48 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYITEMBACKUPSTRATEGY_H
+#define MVVM_SERIALIZATION_BINARYITEMBACKUPSTRATEGY_H
+
+#include <memory>
+#include <mvvm/serialization/itembackupstrategy.h>
+
+class QDataStream;
+
+namespace ModelView
+{
+
+class SessionItem;
+class ItemFactoryInterface;
+
+//! Provide backup of SessionItem using compact binary representation in contiguous memory buffer.
+//! Doubles are stored bit-exact. Restored item will have same identifiers as original.
+
+class CORE_EXPORT BinaryItemBackupStrategy : public ItemBackupStrategy
+{
+public:
+    BinaryItemBackupStrategy(const ItemFactoryInterface* item_factory, bool compress = false);
+    ~BinaryItemBackupStrategy() override;
+
+    std::unique_ptr<SessionItem> restoreItem() const override;
+
+    void saveItem(const SessionItem* item) override;
+
+private:
+    void write_item(QDataStream& stream, const SessionItem& item) const;
+    std::unique_ptr<SessionItem> read_item(QDataStream& stream,
+                                           SessionItem* parent = nullptr) const;
+
+    struct BinaryItemBackupStrategyImpl;
+    std::unique_ptr<BinaryItemBackupStrategyImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYITEMBACKUPSTRATEGY_H
@@ -0,0 +1,71 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/core/uniqueidgenerator.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/itemfactoryinterface.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionitemcontainer.h>
+#include <mvvm/model/sessionitemdata.h>
+#include <mvvm/model/sessionitemtags.h>
+#include <mvvm/serialization/directitemcopystrategy.h>
+
+using namespace ModelView;
+
+//! Constructor of copy strategy.
+//! @param item_factory: SessionItem factory.
+//! @param new_id_flag: generates new item's unique identifiers if true, exact clones otherwise.
+
+DirectItemCopyStrategy::DirectItemCopyStrategy(const ItemFactoryInterface* item_factory,
+                                               bool new_id_flag)
+    : m_factory(item_factory), m_generate_new_identifiers(new_id_flag)
+{
+}
+
+std::unique_ptr<SessionItem> DirectItemCopyStrategy::createCopy(const SessionItem* item) const
+{
+    return item ? clone_item(*item) : std::unique_ptr<SessionItem>();
+}
+
+//! Creates item of the same type and populates it with the copy of original's data and tags.
+//! Variants are implicitly shared, so bulk data isn't copied until one of the items modifies it.
+
+std::unique_ptr<SessionItem> DirectItemCopyStrategy::clone_item(const SessionItem& item,
+                                                                SessionItem* parent) const
+{
+    auto result = m_factory->createItem(item.modelType());
+    result->setParent(parent);
+
+    result->setDataAndTags(std::make_unique<SessionItemData>(*item.itemData()),
+                           clone_tags(*item.itemTags(), result.get()));
+
+    if (m_generate_new_identifiers)
+        result->setData(QVariant::fromValue(UniqueIdGenerator::generate()),
+                        ItemDataRole::IDENTIFIER);
+
+    return result;
+}
+
+std::unique_ptr<SessionItemTags> DirectItemCopyStrategy::clone_tags(const SessionItemTags& tags,
+                                                                    SessionItem* parent) const
+{
+    auto result = std::make_unique<SessionItemTags>();
+    result->setDefaultTag(tags.defaultTag());
+
+    for (auto container : tags) {
+        const auto tagInfo = container->tagInfo();
+        result->registerTag(tagInfo);
+        for (auto item : *container) {
+            auto child = clone_item(*item, parent);
+            result->insertItem(child.release(), TagRow::append(tagInfo.name()));
+        }
+    }
+
+    return result;
+}
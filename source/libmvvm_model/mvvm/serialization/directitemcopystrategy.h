@@ -0,0 +1,44 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_DIRECTITEMCOPYSTRATEGY_H
+#define MVVM_SERIALIZATION_DIRECTITEMCOPYSTRATEGY_H
+
+#include <memory>
+#include <mvvm/serialization/itemcopystrategy.h>
+
+namespace ModelView
+{
+
+class SessionItem;
+class SessionItemTags;
+class ItemFactoryInterface;
+
+//! Provide SessionItem copying by cloning item's data and tags in memory, without json round trip.
+
+class CORE_EXPORT DirectItemCopyStrategy : public ItemCopyStrategy
+{
+public:
+    DirectItemCopyStrategy(const ItemFactoryInterface* item_factory, bool new_id_flag = true);
+
+    std::unique_ptr<SessionItem> createCopy(const SessionItem* item) const override;
+
+private:
+    std::unique_ptr<SessionItem> clone_item(const SessionItem& item,
+                                            SessionItem* parent = nullptr) const;
+    std::unique_ptr<SessionItemTags> clone_tags(const SessionItemTags& tags,
+                                                SessionItem* parent) const;
+
+    const ItemFactoryInterface* m_factory;
+    bool m_generate_new_identifiers;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_DIRECTITEMCOPYSTRATEGY_H
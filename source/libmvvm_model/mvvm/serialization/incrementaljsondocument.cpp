@@ -0,0 +1,538 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <iterator>
+#include <mvvm/model/itemutils.h>
+#include <mvvm/model/modelutils.h>
+#include <mvvm/model/path.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionitemdata.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/incrementaljsondocument.h>
+#include <mvvm/serialization/jsonitemconverter.h>
+#include <mvvm/serialization/jsonitemdata.h>
+#include <mvvm/serialization/jsonmodelconverter.h>
+#include <mvvm/signals/modelmapper.h>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+const QString snapshotKey = "snapshot";
+const QString recordTypeKey = "type";
+const QString modelIndexKey = "model";
+const QString pathKey = "path";
+const QString contentKey = "content";
+
+const QString modelRecord = "model"; //!< record with the full content of the model
+const QString itemRecord = "item";   //!< record with the content of item and all its children
+const QString dataRecord = "data";   //!< record with the data of single item
+const QString insertRecord = "insert"; //!< record with the content of inserted top level item
+const QString removeRecord = "remove"; //!< record of removed top level item
+
+bool has_ancestor_in(const std::set<SessionItem*>& items, const SessionItem* item);
+QJsonArray path_to_json(const Path& path);
+QJsonObject patch_item(const QJsonObject& item_json, Path::const_iterator begin,
+                       Path::const_iterator end, const QJsonObject& record);
+QByteArray read_file(const std::string& file_name);
+void write_file(const std::string& file_name, const QByteArray& content);
+QByteArray checksum(const QByteArray& content);
+
+//! Insertion or removal of top level item. Row is the index of the item among top level items.
+
+struct RootChange {
+    bool is_insert{false};
+    int row{0};
+    SessionItem* item{nullptr}; //!< inserted item, nullptr if it was removed afterwards
+};
+
+//! Changes in single model since the last save.
+
+struct ModelJournal {
+    SessionModel* model{nullptr};
+    bool reset{false};                    //!< the whole model has to be saved
+    std::vector<RootChange> root_changes; //!< changes of top level items in order of appearance
+    std::set<SessionItem*> subtrees;      //!< items with changed children
+    std::set<SessionItem*> data;          //!< items with changed data
+};
+} // namespace
+
+struct IncrementalJsonDocument::IncrementalJsonDocumentImpl {
+    std::vector<ModelJournal> journals;
+    QByteArray snapshot_checksum; //!< checksum of the snapshot the journal is based on
+
+    IncrementalJsonDocumentImpl(std::initializer_list<SessionModel*> models)
+    {
+        for (auto model : models)
+            journals.push_back({model, false, {}, {}, {}});
+
+        for (size_t index = 0; index < journals.size(); ++index)
+            subscribe(index);
+    }
+
+    ~IncrementalJsonDocumentImpl()
+    {
+        for (auto& journal : journals)
+            if (journal.model)
+                journal.model->mapper()->unsubscribe(this);
+    }
+
+    void subscribe(size_t index)
+    {
+        auto mapper = journals[index].model->mapper();
+
+        auto on_data_change = [this, index](SessionItem* item, int) {
+            auto& journal = journals[index];
+            if (item == journal.model->rootItem())
+                journal.reset = true;
+            else
+                journal.data.insert(item);
+        };
+        mapper->setOnDataChange(on_data_change, this);
+
+        auto on_item_inserted = [this, index](SessionItem* parent, TagRow tagrow) {
+            auto item = parent->getItem(tagrow.tag, tagrow.row);
+            mark_structure_change(journals[index], parent, item, /*is_insert*/ true);
+        };
+        mapper->setOnItemInserted(on_item_inserted, this);
+
+        auto on_about_to_remove = [this, index](SessionItem* parent, TagRow tagrow) {
+            auto item = parent->getItem(tagrow.tag, tagrow.row);
+            forget_subtree(journals[index], item);
+            mark_structure_change(journals[index], parent, item, /*is_insert*/ false);
+        };
+        mapper->setOnAboutToRemoveItem(on_about_to_remove, this);
+
+        auto on_model_reset = [this, index](SessionModel*) {
+            auto& journal = journals[index];
+            journal.root_changes.clear();
+            journal.subtrees.clear();
+            journal.data.clear();
+            journal.reset = true;
+        };
+        mapper->setOnModelReset(on_model_reset, this);
+
+        auto on_model_destroyed = [this, index](SessionModel*) {
+            journals[index] = ModelJournal();
+        };
+        mapper->setOnModelDestroyed(on_model_destroyed, this);
+    }
+
+    //! Records insertion or removal of given item. Changes of top level items are recorded in
+    //! order for given item only, otherwise children of the parent are marked as changed.
+
+    void mark_structure_change(ModelJournal& journal, SessionItem* parent, SessionItem* item,
+                               bool is_insert)
+    {
+        if (parent != journal.model->rootItem()) {
+            journal.subtrees.insert(parent);
+            return;
+        }
+
+        const int row = Utils::IndexOfChild(parent, item);
+        if (is_insert) {
+            journal.root_changes.push_back({true, row, item});
+        } else {
+            for (auto& change : journal.root_changes)
+                if (change.item == item)
+                    change.item = nullptr;
+            journal.root_changes.push_back({false, row, nullptr});
+        }
+    }
+
+    //! Removes given item and all its descendants from the journal.
+
+    void forget_subtree(ModelJournal& journal, const SessionItem* item)
+    {
+        auto is_in_subtree = [item](const SessionItem* x) {
+            for (auto current = x; current; current = current->parent())
+                if (current == item)
+                    return true;
+            return false;
+        };
+
+        for (auto container : {&journal.subtrees, &journal.data})
+            for (auto it = container->begin(); it != container->end();)
+                it = is_in_subtree(*it) ? container->erase(it) : std::next(it);
+    }
+
+    bool isModified() const
+    {
+        for (const auto& journal : journals)
+            if (journal.reset || !journal.root_changes.empty() || !journal.subtrees.empty()
+                || !journal.data.empty())
+                return true;
+        return false;
+    }
+
+    void clearModified()
+    {
+        for (auto& journal : journals) {
+            journal.reset = false;
+            journal.root_changes.clear();
+            journal.subtrees.clear();
+            journal.data.clear();
+        }
+    }
+
+    //! Returns journal records representing all changes since the last save. Changes of top level
+    //! items go first, so paths of other records refer to the current layout of the model.
+    //! Records don't overlap: changes inside of changed subtree are not recorded separately.
+
+    QJsonArray collect_records() const
+    {
+        QJsonArray result;
+        for (size_t index = 0; index < journals.size(); ++index) {
+            const auto& journal = journals[index];
+            if (!journal.model)
+                continue;
+
+            if (journal.reset) {
+                QJsonObject content;
+                JsonModelConverter().model_to_json(*journal.model, content);
+                result.append(create_record(modelRecord, index, Path(), content));
+                continue;
+            }
+
+            JsonItemConverter item_converter(journal.model->factory());
+            std::set<SessionItem*> inserted;
+            for (const auto& change : journal.root_changes) {
+                auto path = Path::fromVector({change.row});
+                if (!change.is_insert) {
+                    result.append(create_record(removeRecord, index, path, QJsonValue()));
+                    continue;
+                }
+                // item removed afterwards is represented by the placeholder removed by later record
+                auto content = change.item ? item_converter.to_json(change.item) : QJsonObject();
+                result.append(create_record(insertRecord, index, path, content));
+                if (change.item)
+                    inserted.insert(change.item);
+            }
+
+            auto is_recorded = [&journal, &inserted](SessionItem* item) {
+                return has_ancestor_in(journal.subtrees, item) || inserted.count(item)
+                       || has_ancestor_in(inserted, item);
+            };
+
+            for (auto item : journal.subtrees) {
+                if (is_recorded(item))
+                    continue;
+                auto path = journal.model->pathFromItem(item);
+                result.append(create_record(itemRecord, index, path, item_converter.to_json(item)));
+            }
+
+            JsonItemData data_converter;
+            for (auto item : journal.data) {
+                if (journal.subtrees.count(item) || is_recorded(item))
+                    continue;
+                SessionItemData data;
+                for (auto role : item->roles())
+                    data.setData(item->data(role), role);
+                auto path = journal.model->pathFromItem(item);
+                auto content = data_converter.get_json(data);
+                result.append(create_record(dataRecord, index, path, content));
+            }
+        }
+        return result;
+    }
+
+    static QJsonObject create_record(const QString& type, size_t index, const Path& path,
+                                     const QJsonValue& content)
+    {
+        QJsonObject result;
+        result[recordTypeKey] = type;
+        result[modelIndexKey] = static_cast<int>(index);
+        result[pathKey] = path_to_json(path);
+        result[contentKey] = content;
+        return result;
+    }
+
+    //! Applies journal record to the array of json objects representing models.
+
+    static void apply_record(QJsonArray& models_json, const QJsonObject& record)
+    {
+        const int index = record[modelIndexKey].toInt();
+        if (index < 0 || index >= models_json.size())
+            throw std::runtime_error("Error in IncrementalJsonDocument: invalid model index.");
+
+        const auto type = record[recordTypeKey].toString();
+        if (type == modelRecord) {
+            models_json[index] = record[contentKey];
+            return;
+        }
+
+        std::vector<int> path_data;
+        for (const auto x : record[pathKey].toArray())
+            path_data.push_back(x.toInt());
+        auto path = Path::fromVector(path_data);
+        if (path.begin() == path.end())
+            throw std::runtime_error("Error in IncrementalJsonDocument: empty item path.");
+
+        auto model_json = models_json[index].toObject();
+        auto items = model_json[JsonModelConverter::itemsKey].toArray();
+        const int row = *path.begin();
+        const int max_row = type == insertRecord ? items.size() : items.size() - 1;
+        if (row < 0 || row > max_row)
+            throw std::runtime_error("Error in IncrementalJsonDocument: invalid item path.");
+
+        if (type == insertRecord)
+            items.insert(row, record[contentKey]);
+        else if (type == removeRecord)
+            items.removeAt(row);
+        else
+            items[row] =
+                patch_item(items[row].toObject(), std::next(path.begin()), path.end(), record);
+        model_json[JsonModelConverter::itemsKey] = items;
+        models_json[index] = model_json;
+    }
+};
+
+IncrementalJsonDocument::IncrementalJsonDocument(std::initializer_list<SessionModel*> models)
+    : p_impl(std::make_unique<IncrementalJsonDocumentImpl>(models))
+{
+}
+
+IncrementalJsonDocument::~IncrementalJsonDocument() = default;
+
+//! Saves full snapshot of models on disk. Existing journal is discarded. Items of models loaded
+//! lazily are loaded first.
+
+void IncrementalJsonDocument::save(const std::string& file_name) const
+{
+    JsonModelConverter converter;
+    QJsonArray array;
+
+    for (const auto& journal : p_impl->journals) {
+        QJsonObject object;
+        if (journal.model) {
+            Utils::FetchItems(journal.model);
+            converter.model_to_json(*journal.model, object);
+        }
+        array.push_back(object);
+    }
+
+    auto content = QJsonDocument(array).toJson();
+    write_file(file_name, content);
+    QFile::remove(QString::fromStdString(journalName(file_name)));
+
+    p_impl->snapshot_checksum = checksum(content);
+    p_impl->clearModified();
+}
+
+//! Loads models from the snapshot and replays the journal on top of it, if the journal exists.
+//! If models have some data already, it will be rewritten. Increment which wasn't completely
+//! written is cut off the journal, and obsolete journal is removed, so next increments are
+//! appended to the valid journal.
+
+void IncrementalJsonDocument::load(const std::string& file_name)
+{
+    auto content = read_file(file_name);
+    auto snapshot_checksum = checksum(content);
+
+    auto array = QJsonDocument::fromJson(content).array();
+    if (array.size() != static_cast<int>(p_impl->journals.size())) {
+        std::ostringstream ostr;
+        ostr << "Error in IncrementalJsonDocument: number of application models "
+             << p_impl->journals.size() << " and number of json models " << array.size()
+             << " doesn't match";
+        throw std::runtime_error(ostr.str());
+    }
+
+    QFile journal(QString::fromStdString(journalName(file_name)));
+    if (journal.open(QIODevice::ReadOnly)) {
+        auto header_line = journal.readLine();
+        auto header = QJsonDocument::fromJson(header_line).object();
+        // journal written for another snapshot, or with incomplete header, is obsolete
+        const bool is_obsolete = !header_line.endsWith('\n')
+                                 || header[snapshotKey].toString().toLatin1() != snapshot_checksum;
+        qint64 valid_size = journal.pos();
+        while (!is_obsolete && !journal.atEnd()) {
+            auto line = journal.readLine();
+            QJsonParseError error;
+            auto records = QJsonDocument::fromJson(line, &error);
+            // increment which wasn't completely written (crash during autosave) is ignored
+            if (!line.endsWith('\n') || error.error != QJsonParseError::NoError)
+                break;
+            for (const auto record : records.array())
+                IncrementalJsonDocumentImpl::apply_record(array, record.toObject());
+            valid_size = journal.pos();
+        }
+        journal.close();
+
+        // next increments have to be appended right after the last complete one
+        if (is_obsolete)
+            journal.remove();
+        else if (valid_size < journal.size())
+            journal.resize(valid_size);
+    }
+
+    JsonModelConverter converter;
+    int index(0);
+    for (const auto& journal : p_impl->journals) {
+        auto model_json = array.at(index++).toObject();
+        if (!journal.model)
+            continue;
+        journal.model->clear();
+        converter.json_to_model(model_json, *journal.model);
+    }
+
+    p_impl->snapshot_checksum = snapshot_checksum;
+    p_impl->clearModified();
+}
+
+//! Appends all changes since the last save to the journal. If there is no snapshot yet, or
+//! the journal is getting larger than the snapshot, full snapshot is saved instead. Items of
+//! models loaded lazily are loaded first, their loading is recorded as a change.
+
+void IncrementalJsonDocument::saveIncrement(const std::string& file_name)
+{
+    if (!isModified())
+        return;
+
+    for (const auto& journal : p_impl->journals)
+        if (journal.model)
+            Utils::FetchItems(journal.model);
+
+    QFile snapshot(QString::fromStdString(file_name));
+    if (p_impl->snapshot_checksum.isEmpty() || !snapshot.exists()) {
+        save(file_name);
+        return;
+    }
+
+    QFile journal(QString::fromStdString(journalName(file_name)));
+    if (!journal.open(QIODevice::Append))
+        throw std::runtime_error("Error in IncrementalJsonDocument: can't write the file '"
+                                 + journalName(file_name) + "'");
+
+    if (journal.size() == 0) {
+        QJsonObject header;
+        header[snapshotKey] = QString::fromLatin1(p_impl->snapshot_checksum);
+        journal.write(QJsonDocument(header).toJson(QJsonDocument::Compact) + "\n");
+    }
+
+    auto records = p_impl->collect_records();
+    journal.write(QJsonDocument(records).toJson(QJsonDocument::Compact) + "\n");
+    journal.close();
+
+    p_impl->clearModified();
+
+    if (journal.size() > snapshot.size())
+        save(file_name);
+}
+
+//! Returns true if models were modified since the last save or load.
+
+bool IncrementalJsonDocument::isModified() const
+{
+    return p_impl->isModified();
+}
+
+//! Returns the name of the journal file for given snapshot file name.
+
+std::string IncrementalJsonDocument::journalName(const std::string& file_name)
+{
+    return file_name + ".journal";
+}
+
+namespace
+{
+
+//! Returns true if one of item's ancestors is in the given set.
+
+bool has_ancestor_in(const std::set<SessionItem*>& items, const SessionItem* item)
+{
+    for (auto parent = item->parent(); parent; parent = parent->parent())
+        if (items.count(parent))
+            return true;
+    return false;
+}
+
+QJsonArray path_to_json(const Path& path)
+{
+    QJsonArray result;
+    for (auto x : path)
+        result.append(x);
+    return result;
+}
+
+//! Returns copy of item's json object, where item at the end of the path is replaced according
+//! to the journal record. Path elements are indices of children, as given by
+//! SessionItem::children().
+
+QJsonObject patch_item(const QJsonObject& item_json, Path::const_iterator begin,
+                       Path::const_iterator end, const QJsonObject& record)
+{
+    if (begin == end) {
+        if (record[recordTypeKey].toString() == itemRecord)
+            return record[contentKey].toObject();
+
+        auto result = item_json;
+        result[JsonItemConverter::itemDataKey] = record[contentKey];
+        return result;
+    }
+
+    auto result = item_json;
+    auto tags = result[JsonItemConverter::itemTagsKey].toObject();
+    auto containers = tags[JsonItemConverter::containerKey].toArray();
+    int row = *begin;
+    for (int index = 0; index < containers.size(); ++index) {
+        auto container = containers[index].toObject();
+        auto items = container[JsonItemConverter::itemsKey].toArray();
+        if (row < items.size()) {
+            items[row] = patch_item(items[row].toObject(), std::next(begin), end, record);
+            container[JsonItemConverter::itemsKey] = items;
+            containers[index] = container;
+            tags[JsonItemConverter::containerKey] = containers;
+            result[JsonItemConverter::itemTagsKey] = tags;
+            return result;
+        }
+        row -= items.size();
+    }
+
+    throw std::runtime_error("Error in IncrementalJsonDocument: invalid item path.");
+}
+
+QByteArray read_file(const std::string& file_name)
+{
+    QFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::ReadOnly))
+        throw std::runtime_error("Error in IncrementalJsonDocument: can't read the file '"
+                                 + file_name + "'");
+    return file.readAll();
+}
+
+//! Writes content to the file. Previous file content is replaced atomically.
+
+void write_file(const std::string& file_name, const QByteArray& content)
+{
+    QSaveFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::WriteOnly))
+        throw std::runtime_error("Error in IncrementalJsonDocument: can't save the file '"
+                                 + file_name + "'");
+    file.write(content);
+    if (!file.commit())
+        throw std::runtime_error("Error in IncrementalJsonDocument: can't save the file '"
+                                 + file_name + "'");
+}
+
+QByteArray checksum(const QByteArray& content)
+{
+    return QCryptographicHash::hash(content, QCryptographicHash::Md5).toHex();
+}
+
+} // namespace
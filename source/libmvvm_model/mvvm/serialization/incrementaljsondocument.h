@@ -0,0 +1,56 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_INCREMENTALJSONDOCUMENT_H
+#define MVVM_SERIALIZATION_INCREMENTALJSONDOCUMENT_H
+
+#include <initializer_list>
+#include <memory>
+#include <mvvm/core/modeldocumentinterface.h>
+#include <string>
+
+namespace ModelView
+{
+
+class SessionModel;
+
+/*!
+@class IncrementalJsonDocument
+@brief Saves and restores list of SessionModel's to/from disk using json snapshot and journal.
+
+Full snapshot has the same format as the one of JsonDocument. Document tracks subtrees of models
+which were changed since the last save. On saveIncrement() only these subtrees are appended to
+the journal file next to the snapshot. Journal is compacted into new snapshot when it grows
+larger than the snapshot itself. On load the journal is replayed on top of the snapshot, which
+allows to recover the session after the crash.
+*/
+
+class CORE_EXPORT IncrementalJsonDocument : public ModelDocumentInterface
+{
+public:
+    IncrementalJsonDocument(std::initializer_list<SessionModel*> models);
+    ~IncrementalJsonDocument() override;
+
+    void save(const std::string& file_name) const override;
+    void load(const std::string& file_name) override;
+
+    void saveIncrement(const std::string& file_name);
+
+    bool isModified() const;
+
+    static std::string journalName(const std::string& file_name);
+
+private:
+    struct IncrementalJsonDocumentImpl;
+    std::unique_ptr<IncrementalJsonDocumentImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_INCREMENTALJSONDOCUMENT_H
@@ -11,6 +11,7 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <mvvm/model/modelutils.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/serialization/jsondocument.h>
 #include <mvvm/serialization/jsonmodelconverter.h>
@@ -31,7 +32,7 @@ JsonDocument::JsonDocument(std::initializer_list<ModelView::SessionModel*> model
 {
 }
 
-//! Saves models on disk.
+//! Saves models on disk. Items of models loaded lazily are loaded first.
 
 void JsonDocument::save(const std::string& file_name) const
 {
@@ -39,6 +40,7 @@ void JsonDocument::save(const std::string& file_name) const
     QJsonArray array;
 
     for (auto model : p_impl->models) {
+        Utils::FetchItems(model);
         QJsonObject object;
         converter.model_to_json(*model, object);
         array.push_back(object);
@@ -20,13 +20,7 @@
 #include <mvvm/serialization/jsonitemconverter.h>
 #include <mvvm/serialization/jsonitemdata.h>
 #include <mvvm/serialization/jsontaginfo.h>
-
-namespace
-{
-QStringList expected_item_keys();
-QStringList expected_tags_keys();
-QStringList expected_itemcontainer_keys();
-} // namespace
+#include <mvvm/serialization/jsonutils.h>
 
 using namespace ModelView;
 
@@ -59,6 +53,10 @@ QJsonObject JsonItemConverter::to_json(const SessionItem* item) const
     if (!item)
         return QJsonObject();
 
+    // placeholder of the item loaded lazily would be written as an empty item
+    if (item->model() && item->model()->canFetchItem(item))
+        throw std::runtime_error("JsonItemConverter::to_json() -> Error. Item isn't loaded yet.");
+
     return item_to_json(*item);
 }
 
@@ -71,9 +69,9 @@ std::unique_ptr<SessionItem> JsonItemConverter::from_json(const QJsonObject& jso
 
 bool JsonItemConverter::isSessionItem(const QJsonObject& json) const
 {
-    static const QStringList expected = expected_item_keys();
+    static const QStringList expected = {modelKey, itemDataKey, itemTagsKey};
 
-    if (json.keys() != expected)
+    if (!JsonUtils::HasExactKeys(json, expected))
         return false;
 
     if (!json[itemDataKey].isArray())
@@ -89,9 +87,9 @@ bool JsonItemConverter::isSessionItem(const QJsonObject& json) const
 
 bool JsonItemConverter::isSessionItemTags(const QJsonObject& json) const
 {
-    static const QStringList expected = expected_tags_keys();
+    static const QStringList expected = {defaultTagKey, containerKey};
 
-    if (json.keys() != expected)
+    if (!JsonUtils::HasExactKeys(json, expected))
         return false;
 
     if (!json[containerKey].isArray())
@@ -104,9 +102,9 @@ bool JsonItemConverter::isSessionItemTags(const QJsonObject& json) const
 
 bool JsonItemConverter::isSessionItemContainer(const QJsonObject& json) const
 {
-    static const QStringList expected = expected_itemcontainer_keys();
+    static const QStringList expected = {tagInfoKey, itemsKey};
 
-    if (json.keys() != expected)
+    if (!JsonUtils::HasExactKeys(json, expected))
         return false;
 
     if (!json[tagInfoKey].isObject())
@@ -207,41 +205,3 @@ std::unique_ptr<SessionItemTags> JsonItemConverter::json_to_tags(const QJsonObje
 
     return result;
 }
-
-// --- Utilities --------------------------------------------------------------
-
-namespace
-{
-
-//! Returns list of keys which should be in QJsonObject to represent SessionItem.
-
-QStringList expected_item_keys()
-{
-    QStringList result = QStringList()
-                         << JsonItemConverter::modelKey << JsonItemConverter::itemDataKey
-                         << JsonItemConverter::itemTagsKey;
-    std::sort(result.begin(), result.end());
-    return result;
-}
-
-//! Returns list of keys which should be in QJsonObject to represent SessionItemTags.
-
-QStringList expected_tags_keys()
-{
-    QStringList result = QStringList()
-                         << JsonItemConverter::defaultTagKey << JsonItemConverter::containerKey;
-    std::sort(result.begin(), result.end());
-    return result;
-}
-
-//! Returns list of keys which should be in QJsonObject to represent SessionItemContainer.
-
-QStringList expected_itemcontainer_keys()
-{
-    QStringList result = QStringList()
-                         << JsonItemConverter::tagInfoKey << JsonItemConverter::itemsKey;
-    std::sort(result.begin(), result.end());
-    return result;
-}
-
-} // namespace
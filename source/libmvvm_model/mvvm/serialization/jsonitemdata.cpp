@@ -11,6 +11,7 @@
 #include <QJsonObject>
 #include <mvvm/model/sessionitemdata.h>
 #include <mvvm/serialization/jsonitemdata.h>
+#include <mvvm/serialization/jsonutils.h>
 #include <mvvm/serialization/jsonvariant.h>
 #include <stdexcept>
 
@@ -67,8 +68,8 @@ std::unique_ptr<SessionItemData> JsonItemData::get_data(const QJsonArray& object
 
 bool JsonItemData::is_item_data(const QJsonObject& json)
 {
-    static const QStringList expected = QStringList() << roleKey << variantKey;
-    return json.keys() == expected;
+    static const QStringList expected = {roleKey, variantKey};
+    return JsonUtils::HasExactKeys(json, expected);
 }
 
 //! Sets the list of roles which should be excluded from json.
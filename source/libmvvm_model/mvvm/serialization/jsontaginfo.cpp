@@ -12,11 +12,7 @@
 #include <QStringList>
 #include <mvvm/model/taginfo.h>
 #include <mvvm/serialization/jsontaginfo.h>
-
-namespace
-{
-QStringList expected_taginfo_keys();
-}
+#include <mvvm/serialization/jsonutils.h>
 
 using namespace ModelView;
 
@@ -58,9 +54,9 @@ TagInfo JsonTagInfo::from_json(const QJsonObject& object)
 
 bool JsonTagInfo::isTagInfo(const QJsonObject& object)
 {
-    static const QStringList expected = expected_taginfo_keys();
+    static const QStringList expected = {nameKey, minKey, maxKey, modelsKey};
 
-    if (object.keys() != expected)
+    if (!JsonUtils::HasExactKeys(object, expected))
         return false;
 
     if (!object[modelsKey].isArray())
@@ -68,14 +64,3 @@ bool JsonTagInfo::isTagInfo(const QJsonObject& object)
 
     return true;
 }
-
-namespace
-{
-QStringList expected_taginfo_keys()
-{
-    QStringList result = QStringList() << JsonTagInfo::nameKey << JsonTagInfo::minKey
-                                       << JsonTagInfo::maxKey << JsonTagInfo::modelsKey;
-    std::sort(result.begin(), result.end());
-    return result;
-}
-} // namespace
@@ -9,6 +9,8 @@
 
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QStringList>
+#include <algorithm>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/serialization/jsonconverterinterfaces.h>
 #include <mvvm/serialization/jsonmodelconverter.h>
@@ -71,3 +73,15 @@ RealLimits JsonUtils::CreateLimits(const std::string& text, double min, double m
     else
         throw std::runtime_error("JsonUtils::CreateLimits -> Unknown type");
 }
+
+//! Returns true if json object contains exactly given keys (order doesn't matter).
+//! Doesn't allocate, in contrast to the comparison of QJsonObject::keys() with expected list.
+
+bool JsonUtils::HasExactKeys(const QJsonObject& json, const QStringList& keys)
+{
+    if (json.size() != keys.size())
+        return false;
+
+    return std::all_of(keys.begin(), keys.end(),
+                       [&json](const auto& key) { return json.contains(key); });
+}
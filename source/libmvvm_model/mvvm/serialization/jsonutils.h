@@ -13,6 +13,9 @@
 #include <mvvm/core/export.h>
 #include <string>
 
+class QJsonObject;
+class QStringList;
+
 namespace ModelView
 {
 
@@ -30,6 +33,9 @@ CORE_EXPORT std::string ToString(const RealLimits& limits);
 
 CORE_EXPORT RealLimits CreateLimits(const std::string& text, double min = 0.0, double max = 0.0);
 
+//! Returns true if json object contains exactly given keys (order doesn't matter).
+CORE_EXPORT bool HasExactKeys(const QJsonObject& json, const QStringList& keys);
+
 } // namespace JsonUtils
 
 } // namespace ModelView
@@ -9,6 +9,7 @@
 
 #include <QJsonArray>
 #include <QJsonObject>
+#include <algorithm>
 #include <mvvm/model/comboproperty.h>
 #include <mvvm/model/customvariants.h>
 #include <mvvm/model/externalproperty.h>
@@ -33,8 +34,8 @@ const QString extPropertyIdKey = "identifier";
 const QString realLimitsTextKey = "text";
 const QString realLimitsMinKey = "min";
 const QString realLimitsMaxKey = "max";
-
-QStringList expected_variant_keys();
+const QString numericArrayElementKey = "element";
+const QString numericArrayValuesKey = "values";
 
 QJsonObject from_invalid(const QVariant& variant);
 QVariant to_invalid(const QJsonObject& object);
@@ -66,31 +67,41 @@ QVariant to_extproperty(const QJsonObject& object);
 QJsonObject from_reallimits(const QVariant& variant);
 QVariant to_reallimits(const QJsonObject& object);
 
+QJsonObject from_numericarray(const QVariant& variant);
+QVariant to_numericarray(const QJsonObject& object);
+
 } // namespace
 
 JsonVariant::JsonVariant()
 {
-    m_converters[Constants::invalid_type_name] = {from_invalid, to_invalid};
-    m_converters[Constants::bool_type_name] = {from_bool, to_bool};
-    m_converters[Constants::int_type_name] = {from_int, to_int};
-    m_converters[Constants::string_type_name] = {from_string, to_string};
-    m_converters[Constants::double_type_name] = {from_double, to_double};
-    m_converters[Constants::vector_double_type_name] = {from_vector_double, to_vector_double};
-    m_converters[Constants::comboproperty_type_name] = {from_comboproperty, to_comboproperty};
-    m_converters[Constants::qcolor_type_name] = {from_qcolor, to_qcolor};
-    m_converters[Constants::extproperty_type_name] = {from_extproperty, to_extproperty};
-    m_converters[Constants::reallimits_type_name] = {from_reallimits, to_reallimits};
+    registerConverters(QMetaType::UnknownType, Constants::invalid_type_name,
+                       {from_invalid, to_invalid});
+    registerConverters(QMetaType::Bool, Constants::bool_type_name, {from_bool, to_bool});
+    registerConverters(QMetaType::Int, Constants::int_type_name, {from_int, to_int});
+    registerConverters(qMetaTypeId<std::string>(), Constants::string_type_name,
+                       {from_string, to_string});
+    registerConverters(QMetaType::Double, Constants::double_type_name, {from_double, to_double});
+    registerConverters(qMetaTypeId<std::vector<double>>(), Constants::vector_double_type_name,
+                       {from_vector_double, to_vector_double});
+    registerConverters(qMetaTypeId<ComboProperty>(), Constants::comboproperty_type_name,
+                       {from_comboproperty, to_comboproperty});
+    registerConverters(QMetaType::QColor, Constants::qcolor_type_name, {from_qcolor, to_qcolor});
+    registerConverters(qMetaTypeId<ExternalProperty>(), Constants::extproperty_type_name,
+                       {from_extproperty, to_extproperty});
+    registerConverters(qMetaTypeId<RealLimits>(), Constants::reallimits_type_name,
+                       {from_reallimits, to_reallimits});
+    registerConverters(qMetaTypeId<NumericArray>(), Constants::numericarray_type_name,
+                       {from_numericarray, to_numericarray});
 }
 
 QJsonObject JsonVariant::get_json(const QVariant& variant)
 {
-    const std::string type_name = Utils::VariantName(variant);
-
-    if (m_converters.find(type_name) == m_converters.end())
-        throw std::runtime_error("json::get_json() -> Error. Unknown variant type '" + type_name
-                                 + "'.");
+    auto it = m_type_converters.find(Utils::VariantType(variant));
+    if (it == m_type_converters.end())
+        throw std::runtime_error("json::get_json() -> Error. Unknown variant type '"
+                                 + Utils::VariantName(variant) + "'.");
 
-    return m_converters[type_name].variant_to_json(variant);
+    return it->second.variant_to_json(variant);
 }
 
 QVariant JsonVariant::get_variant(const QJsonObject& object)
@@ -101,31 +112,35 @@ QVariant JsonVariant::get_variant(const QJsonObject& object)
         throw std::runtime_error("json::get_variant() -> Error. Invalid json object");
 
     const auto type_name = object[variantTypeKey].toString().toStdString();
-    if (m_converters.find(type_name) == m_converters.end())
+    auto it = m_converters.find(type_name);
+    if (it == m_converters.end())
         throw std::runtime_error("json::get_variant() -> Error. Unknown variant type '" + type_name
                                  + "' in json object.");
 
-    return m_converters[type_name].json_to_variant(object);
+    return it->second.json_to_variant(object);
 }
 
 //! Returns true if given json object represents variant.
 
 bool JsonVariant::isVariant(const QJsonObject& object) const
 {
-    static const QStringList expected = expected_variant_keys();
-    return object.keys() == expected ? true : false;
+    static const QStringList expected = {variantTypeKey, variantValueKey};
+    return JsonUtils::HasExactKeys(object, expected);
 }
 
-namespace
-{
+//! Registers converters for variant with given type id and type name.
+//! Type id is used for fast lookup while writing json, type name while reading it back.
 
-QStringList expected_variant_keys()
+void JsonVariant::registerConverters(int type_id, const std::string& type_name,
+                                     Converters converters)
 {
-    QStringList result = QStringList() << variantTypeKey << variantValueKey;
-    std::sort(result.begin(), result.end());
-    return result;
+    m_converters[type_name] = converters;
+    m_type_converters[type_id] = std::move(converters);
 }
 
+namespace
+{
+
 QJsonObject from_invalid(const QVariant& variant)
 {
     (void)variant;
@@ -307,4 +322,60 @@ QVariant to_reallimits(const QJsonObject& object)
     return QVariant::fromValue(JsonUtils::CreateLimits(text, min, max));
 }
 
+// --- NumericArray ------
+
+const std::vector<std::pair<NumericArray::ElementType, QString>> element_names = {
+    {NumericArray::ElementType::FLOAT32, "float32"},
+    {NumericArray::ElementType::FLOAT64, "float64"},
+    {NumericArray::ElementType::INT32, "int32"}};
+
+QJsonObject from_numericarray(const QVariant& variant)
+{
+    QJsonObject result;
+    result[variantTypeKey] = QString::fromStdString(Constants::numericarray_type_name);
+    const auto& array = *static_cast<const NumericArray*>(variant.constData());
+
+    QJsonObject json_data;
+    for (const auto& [type, name] : element_names)
+        if (type == array.elementType())
+            json_data[numericArrayElementKey] = name;
+    QJsonArray values;
+    for (size_t i = 0; i < array.size(); ++i)
+        values.append(array.value(i));
+    json_data[numericArrayValuesKey] = values;
+
+    result[variantValueKey] = json_data;
+    return result;
+}
+
+QVariant to_numericarray(const QJsonObject& object)
+{
+    QJsonObject json_data = object[variantValueKey].toObject();
+    const auto name = json_data[numericArrayElementKey].toString();
+    auto it = std::find_if(element_names.begin(), element_names.end(),
+                           [&name](const auto& x) { return x.second == name; });
+    if (it == element_names.end())
+        throw std::runtime_error("json::get_variant() -> Error. Unknown element type '"
+                                 + name.toStdString() + "' of numeric array.");
+
+    const auto values = json_data[numericArrayValuesKey].toArray();
+    auto to_array = [&values](auto element) {
+        using element_t = decltype(element);
+        std::vector<element_t> result;
+        result.reserve(static_cast<size_t>(values.size()));
+        for (const auto x : values)
+            result.push_back(static_cast<element_t>(x.toDouble()));
+        return QVariant::fromValue(NumericArray(std::move(result)));
+    };
+
+    switch (it->first) {
+    case NumericArray::ElementType::FLOAT32:
+        return to_array(float());
+    case NumericArray::ElementType::INT32:
+        return to_array(int32_t());
+    default:
+        return to_array(double());
+    }
+}
+
 } // namespace
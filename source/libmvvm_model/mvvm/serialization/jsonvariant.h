@@ -12,6 +12,8 @@
 
 #include <functional>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <mvvm/serialization/jsonvariantinterface.h>
 
 class QJsonObject;
@@ -37,7 +39,12 @@ private:
         std::function<QVariant(const QJsonObject& json)> json_to_variant;
     };
 
+    void registerConverters(int type_id, const std::string& type_name, Converters converters);
+
+    //!< converters to use while reading json, by variant type name
     std::map<std::string, Converters> m_converters;
+    //!< converters to use while writing json, by variant type id
+    std::unordered_map<int, Converters> m_type_converters;
 };
 
 } // namespace ModelView
@@ -0,0 +1,397 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <algorithm>
+#include <map>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/jsonitemconverter.h>
+#include <mvvm/serialization/jsonmodelconverter.h>
+#include <mvvm/serialization/lazyjsondocument.h>
+#include <mvvm/signals/modelmapper.h>
+#include <sstream>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+const QString checksumKey = "checksum";
+const QString modelsKey = "models";
+const QString modelTypeKey = "model";
+const QString itemsKey = "items";
+const QString typeKey = "type";
+const QString identifierKey = "identifier";
+const QString nameKey = "name";
+const QString offsetKey = "offset";
+const QString sizeKey = "size";
+
+QByteArray to_json_string(const std::string& str);
+QByteArray read_file(const std::string& file_name);
+void write_file(const std::string& file_name, const QByteArray& content);
+QByteArray checksum(const QByteArray& content);
+
+//! Top-level item which content wasn't parsed yet.
+
+struct PendingItem {
+    size_t model_index{0};
+    int offset{0}; //!< position of item's json in the main file
+    int size{0};
+};
+
+} // namespace
+
+struct LazyJsonDocument::LazyJsonDocumentImpl {
+    std::vector<SessionModel*> models;
+    QByteArray content; //!< content of the main file, kept until all items are fetched
+    std::map<identifier_type, PendingItem> pending; //!< top-level placeholders by identifier
+
+    LazyJsonDocumentImpl(std::initializer_list<SessionModel*> models) : models(models)
+    {
+        for (size_t index = 0; index < this->models.size(); ++index) {
+            auto model = this->models[index];
+            auto can_fetch = [this](const SessionItem* item) { return is_pending(item); };
+            auto fetcher = [this](SessionItem* item) { fetch(item->identifier()); };
+            model->setItemFetcher(can_fetch, fetcher);
+            auto on_model_destroyed = [this, index](SessionModel*) {
+                this->models[index] = nullptr;
+            };
+            model->mapper()->setOnModelDestroyed(on_model_destroyed, this);
+        }
+    }
+
+    ~LazyJsonDocumentImpl()
+    {
+        for (auto model : models) {
+            if (model) {
+                model->setItemFetcher({}, {});
+                model->mapper()->unsubscribe(this);
+            }
+        }
+    }
+
+    //! Throws if one of the models was destroyed, the document can't be saved or loaded then.
+
+    void check_models() const
+    {
+        if (std::find(models.begin(), models.end(), nullptr) != models.end())
+            throw std::runtime_error("Error in LazyJsonDocument: model was destroyed.");
+    }
+
+    bool is_pending(const SessionItem* item) const
+    {
+        return pending.find(item->identifier()) != pending.end();
+    }
+
+    //! Returns raw json of the pending item.
+
+    QByteArray raw_content(const PendingItem& entry) const
+    {
+        return QByteArray::fromRawData(content.constData() + entry.offset, entry.size);
+    }
+
+    //! Returns pending top-level item containing item with given identifier. Identifiers of
+    //! descendants aren't indexed, they are looked up in the raw content of pending items.
+
+    std::map<identifier_type, PendingItem>::iterator find_pending(const identifier_type& id)
+    {
+        auto it = pending.find(id);
+        if (it != pending.end())
+            return it;
+
+        auto key = to_json_string(id);
+        for (int pos = content.indexOf(key); pos >= 0; pos = content.indexOf(key, pos + 1)) {
+            for (it = pending.begin(); it != pending.end(); ++it)
+                if (pos > it->second.offset && pos < it->second.offset + it->second.size)
+                    return it;
+        }
+        return pending.end();
+    }
+
+    //! Parses the content of top-level item containing item with given identifier and replaces
+    //! the placeholder with it.
+
+    void fetch(const identifier_type& id)
+    {
+        auto it = find_pending(id);
+        if (it == pending.end())
+            return;
+
+        auto identifier = it->first;
+        auto entry = it->second;
+        pending.erase(it);
+
+        auto model = models[entry.model_index];
+        auto placeholder = model ? find_placeholder(*model, identifier) : nullptr;
+        if (placeholder) {
+            auto item = JsonItemConverter(model->factory())
+                            .from_json(QJsonDocument::fromJson(raw_content(entry)).object());
+
+            auto root = model->rootItem();
+            auto tagrow = root->tagRowOfItem(placeholder);
+            delete root->takeItem(tagrow);
+            root->insertItem(item.release(), tagrow);
+        }
+
+        if (pending.empty())
+            content.clear();
+    }
+
+    void fetch_all()
+    {
+        while (!pending.empty())
+            fetch(pending.begin()->first);
+    }
+
+    static SessionItem* find_placeholder(const SessionModel& model, const identifier_type& id)
+    {
+        for (auto item : model.rootItem()->children())
+            if (item->identifier() == id)
+                return item;
+        return nullptr;
+    }
+
+    //! Returns index object if it is valid for the given content of the main file.
+
+    QJsonObject read_index(const std::string& file_name, const QByteArray& main_content) const
+    {
+        QFile file(QString::fromStdString(file_name));
+        if (!file.open(QIODevice::ReadOnly))
+            return {};
+
+        auto index = QJsonDocument::fromJson(file.readAll()).object();
+        if (index[checksumKey].toString().toLatin1() != checksum(main_content))
+            return {};
+
+        if (index[modelsKey].toArray().size() != static_cast<int>(models.size()))
+            return {};
+
+        return index;
+    }
+
+    //! Populates models with placeholders of top-level items listed in the index.
+
+    void load_placeholders(const QJsonObject& index)
+    {
+        auto models_index = index[modelsKey].toArray();
+        for (size_t model_index = 0; model_index < models.size(); ++model_index) {
+            auto model = models[model_index];
+            auto model_json = models_index.at(static_cast<int>(model_index)).toObject();
+            if (model_json[modelTypeKey].toString() != QString::fromStdString(model->modelType()))
+                throw std::runtime_error("Error in LazyJsonDocument: unexpected model type.");
+
+            model->clear();
+            for (const auto ref : model_json[itemsKey].toArray()) {
+                auto json = ref.toObject();
+                auto identifier = json[identifierKey].toString().toStdString();
+                PendingItem entry;
+                entry.model_index = model_index;
+                entry.offset = json[offsetKey].toInt();
+                entry.size = json[sizeKey].toInt();
+                pending[identifier] = entry;
+
+                // placeholder is read-only and has no content, so nothing is lost on fetch
+                auto placeholder =
+                    std::make_unique<SessionItem>(json[typeKey].toString().toStdString());
+                placeholder->setData(QVariant::fromValue(identifier), ItemDataRole::IDENTIFIER);
+                placeholder->setDisplayName(json[nameKey].toString().toStdString());
+                placeholder->setEditable(false);
+                model->rootItem()->insertItem(placeholder.release(), TagRow::append());
+            }
+        }
+    }
+
+    //! Loads models completely, as JsonDocument does.
+
+    void load_all(const QByteArray& main_content)
+    {
+        auto array = QJsonDocument::fromJson(main_content).array();
+        if (array.size() != static_cast<int>(models.size())) {
+            std::ostringstream ostr;
+            ostr << "Error in LazyJsonDocument: number of application models " << models.size()
+                 << " and number of json models " << array.size() << " doesn't match";
+            throw std::runtime_error(ostr.str());
+        }
+
+        JsonModelConverter converter;
+        int index(0);
+        for (auto model : models) {
+            model->clear();
+            converter.json_to_model(array.at(index++).toObject(), *model);
+        }
+    }
+};
+
+LazyJsonDocument::LazyJsonDocument(std::initializer_list<SessionModel*> models)
+    : p_impl(std::make_unique<LazyJsonDocumentImpl>(models))
+{
+}
+
+LazyJsonDocument::~LazyJsonDocument() = default;
+
+//! Saves models on disk together with the index of top-level items.
+//! Items which were not fetched yet are written as they are, without parsing.
+
+void LazyJsonDocument::save(const std::string& file_name) const
+{
+    p_impl->check_models();
+
+    std::map<identifier_type, PendingItem> pending; // placeholders with their new positions
+    QByteArray content("[\n");
+    QJsonArray models_index;
+    for (size_t model_index = 0; model_index < p_impl->models.size(); ++model_index) {
+        auto model = p_impl->models[model_index];
+        if (content.size() > 2)
+            content.append(",\n");
+        content.append("{\"" + JsonModelConverter::modelKey.toLatin1()
+                       + "\":" + to_json_string(model->modelType()) + ",\""
+                       + JsonModelConverter::itemsKey.toLatin1() + "\":[");
+
+        JsonItemConverter converter(model->factory());
+        QJsonArray items_index;
+        for (auto item : model->rootItem()->children()) {
+            if (!items_index.isEmpty())
+                content.append(",");
+            QByteArray item_content;
+            if (auto it = p_impl->pending.find(item->identifier()); it != p_impl->pending.end()) {
+                item_content = p_impl->raw_content(it->second);
+                pending[it->first] = {model_index, content.size(), item_content.size()};
+            } else {
+                item_content =
+                    QJsonDocument(converter.to_json(item)).toJson(QJsonDocument::Compact);
+            }
+
+            QJsonObject entry;
+            entry[typeKey] = QString::fromStdString(item->modelType());
+            entry[identifierKey] = QString::fromStdString(item->identifier());
+            entry[nameKey] = QString::fromStdString(item->displayName());
+            entry[offsetKey] = content.size();
+            entry[sizeKey] = item_content.size();
+            items_index.append(entry);
+
+            content.append(item_content);
+        }
+        content.append("]}");
+
+        QJsonObject model_index;
+        model_index[modelTypeKey] = QString::fromStdString(model->modelType());
+        model_index[itemsKey] = items_index;
+        models_index.append(model_index);
+    }
+    content.append("\n]\n");
+
+    QJsonObject index;
+    index[checksumKey] = QString::fromLatin1(checksum(content));
+    index[modelsKey] = models_index;
+
+    write_file(file_name, content);
+    write_file(indexName(file_name), QJsonDocument(index).toJson(QJsonDocument::Compact));
+
+    // placeholders are fetched from the new content from now on
+    p_impl->pending = pending;
+    p_impl->content = pending.empty() ? QByteArray() : content;
+}
+
+//! Loads placeholders of top-level items from disk. If index is missing or doesn't correspond
+//! to the main file, models are loaded completely. If models have some data already, it will be
+//! rewritten.
+
+void LazyJsonDocument::load(const std::string& file_name)
+{
+    p_impl->check_models();
+
+    p_impl->pending.clear();
+    p_impl->content = read_file(file_name);
+
+    auto index = p_impl->read_index(indexName(file_name), p_impl->content);
+    if (index.isEmpty()) {
+        p_impl->load_all(p_impl->content);
+        p_impl->content.clear();
+    } else {
+        p_impl->load_placeholders(index);
+        if (p_impl->pending.empty())
+            p_impl->content.clear();
+    }
+}
+
+//! Returns true if the content of given item is loaded.
+
+bool LazyJsonDocument::isFetched(const SessionItem* item) const
+{
+    return p_impl->pending.find(item->identifier()) == p_impl->pending.end();
+}
+
+//! Loads the content of top-level item containing item with given identifier. The placeholder
+//! is replaced with the loaded item.
+
+void LazyJsonDocument::fetchItem(const identifier_type& id)
+{
+    p_impl->fetch(id);
+}
+
+//! Loads the content of all top-level items.
+
+void LazyJsonDocument::fetchAll()
+{
+    p_impl->fetch_all();
+}
+
+//! Returns the name of the index file for given file name.
+
+std::string LazyJsonDocument::indexName(const std::string& file_name)
+{
+    return file_name + ".index";
+}
+
+namespace
+{
+
+//! Returns string as it is represented in json document, i.e. quoted and escaped.
+
+QByteArray to_json_string(const std::string& str)
+{
+    QJsonDocument document(QJsonArray{QString::fromStdString(str)});
+    auto result = document.toJson(QJsonDocument::Compact);
+    return result.mid(1, result.size() - 2);
+}
+
+QByteArray read_file(const std::string& file_name)
+{
+    QFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::ReadOnly))
+        throw std::runtime_error("Error in LazyJsonDocument: can't read the file '" + file_name
+                                 + "'");
+    return file.readAll();
+}
+
+void write_file(const std::string& file_name, const QByteArray& content)
+{
+    QSaveFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::WriteOnly))
+        throw std::runtime_error("Error in LazyJsonDocument: can't save the file '" + file_name
+                                 + "'");
+    file.write(content);
+    if (!file.commit())
+        throw std::runtime_error("Error in LazyJsonDocument: can't save the file '" + file_name
+                                 + "'");
+}
+
+QByteArray checksum(const QByteArray& content)
+{
+    return QCryptographicHash::hash(content, QCryptographicHash::Md5).toHex();
+}
+
+} // namespace
@@ -0,0 +1,61 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_LAZYJSONDOCUMENT_H
+#define MVVM_SERIALIZATION_LAZYJSONDOCUMENT_H
+
+#include <initializer_list>
+#include <memory>
+#include <mvvm/core/modeldocumentinterface.h>
+#include <mvvm/core/types.h>
+#include <string>
+
+namespace ModelView
+{
+
+class SessionModel;
+class SessionItem;
+
+/*!
+@class LazyJsonDocument
+@brief Saves and restores list of SessionModel's to/from disk, loading top-level items on demand.
+
+Main file has the same format as the one of JsonDocument. Additionally, the index of top-level
+items (model type, identifier, position in the main file) is saved next to it. On load only
+placeholders of top-level items are created. Placeholders are read-only items without children.
+The content of the item is parsed when the view model in lazy mode fetches the placeholder
+(see SessionModel::fetchItem), or on explicit fetchItem() call. The placeholder is then replaced
+with the loaded item. If the index is missing, the file is loaded completely.
+*/
+
+class CORE_EXPORT LazyJsonDocument : public ModelDocumentInterface
+{
+public:
+    LazyJsonDocument(std::initializer_list<SessionModel*> models);
+    ~LazyJsonDocument() override;
+
+    void save(const std::string& file_name) const override;
+    void load(const std::string& file_name) override;
+
+    bool isFetched(const SessionItem* item) const;
+
+    void fetchItem(const identifier_type& id);
+
+    void fetchAll();
+
+    static std::string indexName(const std::string& file_name);
+
+private:
+    struct LazyJsonDocumentImpl;
+    std::unique_ptr<LazyJsonDocumentImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_LAZYJSONDOCUMENT_H
@@ -7,6 +7,10 @@
 //
 // ************************************************************************** //
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mvvm/model/customvariants.h>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/plottableitems.h>
 
@@ -73,6 +77,20 @@ int BinnedAxisItem::size() const
     return property(P_NBINS).value<int>();
 }
 
+//! Returns center of the first bin, or lower bound of the axis, if it has no bins.
+
+double BinnedAxisItem::front() const
+{
+    return size() > 0 ? binCenter(0) : range().first;
+}
+
+//! Returns center of the last bin, or upper bound of the axis, if it has no bins.
+
+double BinnedAxisItem::back() const
+{
+    return size() > 0 ? binCenter(size() - 1) : range().second;
+}
+
 // --- FixedBinAxisItem ------------------------------------------------------
 
 FixedBinAxisItem::FixedBinAxisItem() : BinnedAxisItem(Constants::FixedBinAxisItemType) {}
@@ -90,6 +108,9 @@ std::vector<double> FixedBinAxisItem::binCenters() const
 {
     std::vector<double> result;
     int nbins = property(P_NBINS).value<int>();
+    if (nbins < 1)
+        return result;
+
     double start = property(P_MIN).value<double>();
     double end = property(P_MAX).value<double>();
     double step = (end - start) / nbins;
@@ -100,3 +121,104 @@ std::vector<double> FixedBinAxisItem::binCenters() const
 
     return result;
 }
+
+//! Returns center of the bin with given index.
+
+double FixedBinAxisItem::binCenter(int index) const
+{
+    if (index < 0 || index >= size())
+        throw std::runtime_error("FixedBinAxisItem::binCenter() -> Bin index is out of range");
+
+    auto [start, end] = range();
+    return start + (end - start) / size() * (index + 0.5);
+}
+
+//! Returns index of the bin containing given coordinate, or -1 if it is outside of the axis.
+//! Upper edge of the axis belongs to the last bin.
+
+int FixedBinAxisItem::findBin(double x) const
+{
+    const int nbins = size();
+    auto [start, end] = range();
+    if (nbins < 1 || x < start || x > end)
+        return -1;
+
+    int result = static_cast<int>(std::floor((x - start) / (end - start) * nbins));
+    return std::min(result, nbins - 1);
+}
+
+// --- VariableBinAxisItem ------------------------------------------------------
+
+VariableBinAxisItem::VariableBinAxisItem() : BinnedAxisItem(Constants::VariableBinAxisItemType)
+{
+    getItem(P_NBINS)->setEditable(false);
+    getItem(P_MIN)->setEditable(false);
+    getItem(P_MAX)->setEditable(false);
+    setDataIntern(QVariant::fromValue(std::vector<double>{0.0, 1.0}), ItemDataRole::DATA);
+}
+
+std::unique_ptr<VariableBinAxisItem>
+VariableBinAxisItem::create(const std::vector<double>& bin_edges)
+{
+    auto result = std::make_unique<VariableBinAxisItem>();
+    result->setBinEdges(bin_edges);
+    return result;
+}
+
+//! Sets bin edges. There should be at least two edges, sorted in increasing order.
+
+void VariableBinAxisItem::setBinEdges(const std::vector<double>& bin_edges)
+{
+    if (bin_edges.size() < 2)
+        throw std::runtime_error(
+            "VariableBinAxisItem::setBinEdges() -> At least two edges are required");
+
+    if (std::adjacent_find(bin_edges.begin(), bin_edges.end(), std::greater_equal<double>())
+        != bin_edges.end())
+        throw std::runtime_error("VariableBinAxisItem::setBinEdges() -> Edges are not sorted");
+
+    setData(QVariant::fromValue(bin_edges));
+    setProperty(P_NBINS, static_cast<int>(bin_edges.size()) - 1);
+    setProperty(P_MIN, bin_edges.front());
+    setProperty(P_MAX, bin_edges.back());
+}
+
+//! Returns bin edges without copying them.
+
+const std::vector<double>& VariableBinAxisItem::binEdges() const
+{
+    return *dataPtr<std::vector<double>>();
+}
+
+std::vector<double> VariableBinAxisItem::binCenters() const
+{
+    std::vector<double> result(static_cast<size_t>(size()));
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = binCenter(static_cast<int>(i));
+    return result;
+}
+
+//! Returns center of the bin with given index.
+
+double VariableBinAxisItem::binCenter(int index) const
+{
+    const auto& edges = binEdges();
+    if (index < 0 || static_cast<size_t>(index) + 1 >= edges.size())
+        throw std::runtime_error("VariableBinAxisItem::binCenter() -> Bin index is out of range");
+
+    return (edges[static_cast<size_t>(index)] + edges[static_cast<size_t>(index) + 1]) / 2.0;
+}
+
+//! Returns index of the bin containing given coordinate, or -1 if it is outside of the axis.
+//! Upper edge of the axis belongs to the last bin.
+
+int VariableBinAxisItem::findBin(double x) const
+{
+    const auto& edges = binEdges();
+    if (x < edges.front() || x > edges.back())
+        return -1;
+
+    auto it = std::upper_bound(edges.begin(), edges.end(), x);
+    int result = static_cast<int>(std::distance(edges.begin(), it)) - 1;
+    return std::min(result, size() - 1);
+}
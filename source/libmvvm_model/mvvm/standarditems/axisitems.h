@@ -84,6 +84,14 @@ public:
     int size() const;
 
     virtual std::vector<double> binCenters() const = 0;
+
+    virtual double binCenter(int index) const = 0;
+
+    virtual int findBin(double x) const = 0;
+
+    double front() const;
+
+    double back() const;
 };
 
 /*!
@@ -102,7 +110,37 @@ public:
 
     static std::unique_ptr<FixedBinAxisItem> create(int nbins, double xmin, double xmax);
 
-    std::vector<double> binCenters() const;
+    std::vector<double> binCenters() const override;
+
+    double binCenter(int index) const override;
+
+    int findBin(double x) const override;
+};
+
+/*!
+@class VariableBinAxisItem
+@brief Item to represent an axis with variable bin width.
+
+Defines an axis via the list of bin edges, which is stored as item's own data. Number of bins
+and axis range are kept in sync with bin edges and can't be edited.
+*/
+
+class CORE_EXPORT VariableBinAxisItem : public BinnedAxisItem
+{
+public:
+    VariableBinAxisItem();
+
+    static std::unique_ptr<VariableBinAxisItem> create(const std::vector<double>& bin_edges);
+
+    void setBinEdges(const std::vector<double>& bin_edges);
+
+    const std::vector<double>& binEdges() const;
+
+    std::vector<double> binCenters() const override;
+
+    double binCenter(int index) const override;
+
+    int findBin(double x) const override;
 };
 
 } // namespace ModelView
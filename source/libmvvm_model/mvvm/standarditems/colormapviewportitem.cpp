@@ -7,7 +7,6 @@
 //
 // ************************************************************************** //
 
-#include <algorithm>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/colormapitem.h>
 #include <mvvm/standarditems/colormapviewportitem.h>
@@ -68,9 +67,8 @@ std::pair<double, double> ColorMapViewportItem::data_yaxis_range() const
 
 void ColorMapViewportItem::update_data_range()
 {
-    if (auto dataItem = data_item(); dataItem) {
-        auto values = dataItem->content();
-        auto [lower, upper] = std::minmax_element(std::begin(values), std::end(values));
-        zAxis()->set_range(*lower, *upper);
+    if (auto dataItem = data_item(); dataItem && !dataItem->contentRef().empty()) {
+        auto [lower, upper] = dataItem->contentRange();
+        zAxis()->set_range(lower, upper);
     }
 }
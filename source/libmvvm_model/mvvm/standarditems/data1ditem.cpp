@@ -7,8 +7,13 @@
 //
 // ************************************************************************** //
 
+#include <algorithm>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/numericarray.h>
+#include <mvvm/model/sessionmodel.h>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/data1ditem.h>
+#include <mvvm/utils/arrayutils.h>
 
 using namespace ModelView;
 
@@ -19,11 +24,43 @@ size_t total_bin_count(Data1DItem* item)
     auto axis = item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
     return axis ? static_cast<size_t>(axis->size()) : 0;
 }
+
+//! Extends fixed bin axis by given number of bins of the same width. For axis without bins,
+//! its range defines the width of the bin.
+
+void extend_axis(FixedBinAxisItem* axis, int count)
+{
+    const int nbins = axis->size();
+    auto [xmin, xmax] = axis->range();
+    const double step = nbins > 0 ? (xmax - xmin) / nbins : xmax - xmin;
+    axis->setProperty(FixedBinAxisItem::P_NBINS, nbins + count);
+    axis->setProperty(FixedBinAxisItem::P_MAX, xmin + step * (nbins + count));
+}
+
+//! Replaces content stored as std::vector<double> by older versions, or as NumericArray of float32
+//! or int32 numbers, with NumericArray of float64 numbers holding the same values. Conversion
+//! bypasses undo/redo framework.
+
+void upgrade_content(SessionItem* item)
+{
+    auto variant = item->data();
+    if (Utils::IsDoubleVectorVariant(variant)) {
+        item->setDataIntern(QVariant::fromValue(NumericArray(variant.value<std::vector<double>>())),
+                            ItemDataRole::DATA);
+    } else if (Utils::IsNumericArrayVariant(variant)) {
+        auto array = variant.value<NumericArray>();
+        if (array.elementType() != NumericArray::ElementType::FLOAT64)
+            item->setDataIntern(QVariant::fromValue(NumericArray(array.toDoubles())),
+                                ItemDataRole::DATA);
+    }
+}
+
 } // namespace
 
 Data1DItem::Data1DItem() : CompoundItem(Constants::Data1DItemType)
 {
-    registerTag(TagInfo(T_AXIS, 0, 1, {Constants::FixedBinAxisItemType}));
+    registerTag(TagInfo(T_AXIS, 0, 1,
+                        {Constants::FixedBinAxisItemType, Constants::VariableBinAxisItemType}));
 }
 
 //! Sets axis. Bin content will be set to zero.
@@ -45,7 +82,19 @@ void Data1DItem::setContent(const std::vector<double>& data)
     if (total_bin_count(this) != data.size())
         throw std::runtime_error("Data1DItem::setContent() -> Data doesn't match size of axis");
 
-    setData(QVariant::fromValue(data));
+    upgrade_content(this);
+    setData(QVariant::fromValue(NumericArray(data)));
+}
+
+//! Sets internal data buffer to given data, the content of the vector is moved in without copying.
+
+void Data1DItem::setContent(std::vector<double>&& data)
+{
+    if (total_bin_count(this) != data.size())
+        throw std::runtime_error("Data1DItem::setContent() -> Data doesn't match size of axis");
+
+    upgrade_content(this);
+    setData(QVariant::fromValue(NumericArray(std::move(data))));
 }
 
 //! Returns coordinates of bin centers.
@@ -60,6 +109,132 @@ std::vector<double> Data1DItem::binCenters() const
 
 std::vector<double> Data1DItem::binValues() const
 {
-    auto variant = data();
-    return variant.isValid() ? variant.value<std::vector<double>>() : std::vector<double>();
+    return binValuesRef();
+}
+
+//! Returns reference to values stored in bins without copying them.
+//! Reference stays valid until the next content change. Float32 and int32 content is returned
+//! converted to float64 numbers.
+
+const std::vector<double>& Data1DItem::binValuesRef() const
+{
+    static const std::vector<double> empty;
+    if (auto array = dataPtr<NumericArray>(); array) {
+        if (array->elementType() == NumericArray::ElementType::FLOAT64)
+            return array->values<double>();
+
+        // float32 and int32 content is converted once per data revision
+        if (m_converted_revision != dataRevision()) {
+            m_converted_values = array->toDoubles();
+            m_converted_revision = dataRevision();
+        }
+        return m_converted_values;
+    }
+
+    // content saved by older versions
+    auto values = dataPtr<std::vector<double>>();
+    return values ? *values : empty;
+}
+
+//! Returns minimum and maximum of values stored in bins, or {0, 0} for empty content. The result is
+//! cached until the next content change, appending values keeps it valid.
+
+std::pair<double, double> Data1DItem::valueRange() const
+{
+    if (m_value_range_revision != dataRevision()) {
+        m_value_range = Utils::MinMax(binValuesRef());
+        m_value_range_revision = dataRevision();
+    }
+    return m_value_range;
+}
+
+//! Modifies the content in place by given function and notifies about data change once. Function
+//! shouldn't change the size of the content, it is intended to be used with operations from
+//! mvvm/utils/arrayutils.h. If undo/redo is enabled, the function is applied to the copy of the
+//! content, which then replaces the content as in setContent().
+
+void Data1DItem::updateContent(const std::function<void(std::vector<double>&)>& func)
+{
+    if (model() && model()->undoStack()) {
+        auto values = binValues();
+        func(values);
+        setContent(std::move(values));
+        return;
+    }
+
+    update_values(func);
+}
+
+//! Appends values to the end of the content. Axis, which should be the fixed bin axis, is extended
+//! by the same number of bins. Amortized cost of the operation doesn't depend on the size of the
+//! content. During the data change notification the number of appended values can be retrieved
+//! via appendedCount(). Axis is already extended at this moment, so subscribers always see the
+//! number of bins matching the number of values. Undo/redo, if enabled, stores only the appended
+//! values. The buffer is extended in place, it is copied only if a copy of the data variant is
+//! kept outside of the item, so subscribers shouldn't store the variant itself.
+
+void Data1DItem::appendContent(const std::vector<double>& data)
+{
+    auto axis = dynamic_cast<FixedBinAxisItem*>(getItem(T_AXIS));
+    if (!axis)
+        throw std::runtime_error("Data1DItem::appendContent() -> Fixed bin axis is required");
+
+    if (total_bin_count(this) != binValuesRef().size())
+        throw std::runtime_error("Data1DItem::appendContent() -> Data doesn't match size of axis");
+
+    if (data.empty())
+        return;
+
+    if (model()) {
+        model()->appendContent(this, data);
+    } else {
+        append_values(data);
+        extend_axis(axis, static_cast<int>(data.size()));
+    }
+}
+
+//! Returns number of values appended to the content, if called during the data change
+//! notification caused by appendContent(). Returns 0 otherwise.
+
+int Data1DItem::appendedCount() const
+{
+    return m_appended_count;
+}
+
+//! Appends values to the content in place and notifies about data change.
+
+void Data1DItem::append_values(const std::vector<double>& values)
+{
+    m_appended_count = static_cast<int>(values.size());
+    const bool is_range_valid = m_value_range_revision == dataRevision();
+    update_values([this, is_range_valid, &values](std::vector<double>& content) {
+        // cached range is extended before subscribers are notified
+        if (is_range_valid) {
+            auto [lower, upper] = Utils::MinMax(values);
+            m_value_range = content.empty() ? std::make_pair(lower, upper)
+                                            : std::make_pair(std::min(lower, m_value_range.first),
+                                                             std::max(upper, m_value_range.second));
+            m_value_range_revision = dataRevision();
+        }
+        content.insert(content.end(), values.begin(), values.end());
+    });
+    m_appended_count = 0;
+}
+
+//! Removes given number of values from the end of the content and notifies about data change.
+
+void Data1DItem::remove_values(size_t count)
+{
+    update_values(
+        [count](std::vector<double>& content) { content.resize(content.size() - count); });
+}
+
+//! Modifies values in place by given function and notifies about data change. Content saved by
+//! older versions, or holding float32 or int32 numbers, is converted to float64 NumericArray first.
+
+void Data1DItem::update_values(const std::function<void(std::vector<double>&)>& func)
+{
+    upgrade_content(this);
+    m_converted_values = {};
+    updateData<NumericArray>([&func](NumericArray& array) { func(array.mutableValues<double>()); });
 }
@@ -10,6 +10,7 @@
 #ifndef MVVM_STANDARDITEMS_DATA1DITEM_H
 #define MVVM_STANDARDITEMS_DATA1DITEM_H
 
+#include <functional>
 #include <mvvm/model/compounditem.h>
 #include <vector>
 
@@ -17,13 +18,17 @@ namespace ModelView
 {
 
 class BinnedAxisItem;
+class ContentAppendCommand;
 
 /*!
 @class Data1DItem
 @brief Represents bare one-dimensional data (axis and values).
 
-Values are stored in Data1DItem itself, axis is attached as a child. Corresponding plot
-properties will be served by GraphItem.
+Values are stored in Data1DItem itself as NumericArray of float64 numbers, axis is attached as a
+child. Corresponding plot properties will be served by GraphItem. Values can be appended to the end
+of the content one by one, which is intended for streaming of time series. Content holding float32
+or int32 numbers is read as converted to float64 and is replaced by float64 numbers on the first
+modification.
 */
 
 class CORE_EXPORT Data1DItem : public CompoundItem
@@ -36,9 +41,33 @@ public:
 
     void setContent(const std::vector<double>& data);
 
+    void setContent(std::vector<double>&& data);
+
     std::vector<double> binCenters() const;
 
     std::vector<double> binValues() const;
+
+    const std::vector<double>& binValuesRef() const;
+
+    std::pair<double, double> valueRange() const;
+
+    void updateContent(const std::function<void(std::vector<double>&)>& func);
+
+    void appendContent(const std::vector<double>& data);
+
+    int appendedCount() const;
+
+private:
+    friend class ContentAppendCommand;
+    void append_values(const std::vector<double>& values);
+    void remove_values(size_t count);
+    void update_values(const std::function<void(std::vector<double>&)>& func);
+
+    int m_appended_count{0}; //!< number of values appended during the current notification
+    mutable std::pair<double, double> m_value_range; //!< cached result of valueRange()
+    mutable int m_value_range_revision{-1}; //!< data revision for which m_value_range is valid
+    mutable std::vector<double> m_converted_values; //!< float64 copy of float32 or int32 content
+    mutable int m_converted_revision{-1}; //!< data revision for which m_converted_values is valid
 };
 
 } // namespace ModelView
@@ -7,8 +7,13 @@
 //
 // ************************************************************************** //
 
+#include <algorithm>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/numericarray.h>
+#include <mvvm/model/sessionmodel.h>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/data2ditem.h>
+#include <mvvm/utils/arrayutils.h>
 
 using namespace ModelView;
 
@@ -21,12 +26,33 @@ size_t total_bin_count(Data2DItem* item)
             return static_cast<size_t>(xaxis->size() * yaxis->size());
     return 0;
 }
+
+//! Replaces content stored as std::vector<double> by older versions, or as NumericArray of float32
+//! or int32 numbers, with NumericArray of float64 numbers holding the same values. Conversion
+//! bypasses undo/redo framework.
+
+void upgrade_content(SessionItem* item)
+{
+    auto variant = item->data();
+    if (Utils::IsDoubleVectorVariant(variant)) {
+        item->setDataIntern(QVariant::fromValue(NumericArray(variant.value<std::vector<double>>())),
+                            ItemDataRole::DATA);
+    } else if (Utils::IsNumericArrayVariant(variant)) {
+        auto array = variant.value<NumericArray>();
+        if (array.elementType() != NumericArray::ElementType::FLOAT64)
+            item->setDataIntern(QVariant::fromValue(NumericArray(array.toDoubles())),
+                                ItemDataRole::DATA);
+    }
+}
+
 } // namespace
 
 Data2DItem::Data2DItem() : CompoundItem(Constants::Data2DItemType)
 {
-    registerTag(TagInfo(T_XAXIS, 0, 1, {Constants::FixedBinAxisItemType}));
-    registerTag(TagInfo(T_YAXIS, 0, 1, {Constants::FixedBinAxisItemType}));
+    const std::vector<std::string> axis_types = {Constants::FixedBinAxisItemType,
+                                                 Constants::VariableBinAxisItemType};
+    registerTag(TagInfo(T_XAXIS, 0, 1, axis_types));
+    registerTag(TagInfo(T_YAXIS, 0, 1, axis_types));
 }
 
 //! Sets axes and put data points to zero.
@@ -53,20 +79,132 @@ BinnedAxisItem* Data2DItem::yAxis() const
     return item<BinnedAxisItem>(T_YAXIS);
 }
 
+//! Sets internal data buffer to given data. If size of axes doesn't match the size of the data,
+//! exception will be thrown.
+
 void Data2DItem::setContent(const std::vector<double>& data)
 {
     if (total_bin_count(this) != data.size())
-        throw std::runtime_error("Data1DItem::setContent() -> Data doesn't match size of axis");
+        throw std::runtime_error("Data2DItem::setContent() -> Data doesn't match size of axes");
 
-    setData(QVariant::fromValue(data));
+    upgrade_content(this);
+    setData(QVariant::fromValue(NumericArray(data)));
+}
+
+//! Sets internal data buffer to given data, the content of the vector is moved in without copying.
+
+void Data2DItem::setContent(std::vector<double>&& data)
+{
+    if (total_bin_count(this) != data.size())
+        throw std::runtime_error("Data2DItem::setContent() -> Data doesn't match size of axes");
+
+    upgrade_content(this);
+    setData(QVariant::fromValue(NumericArray(std::move(data))));
 }
 
 //! Returns 2d vector representing 2d data.
 
 std::vector<double> Data2DItem::content() const
 {
-    auto variant = data();
-    return variant.isValid() ? variant.value<std::vector<double>>() : std::vector<double>();
+    return contentRef();
+}
+
+//! Returns reference to 2d data without copying it.
+//! Reference stays valid until the next content change. Float32 and int32 content is returned
+//! converted to float64 numbers.
+
+const std::vector<double>& Data2DItem::contentRef() const
+{
+    static const std::vector<double> empty;
+    if (auto array = dataPtr<NumericArray>(); array) {
+        if (array->elementType() == NumericArray::ElementType::FLOAT64)
+            return array->values<double>();
+
+        // float32 and int32 content is converted once per data revision
+        if (m_converted_revision != dataRevision()) {
+            m_converted_values = array->toDoubles();
+            m_converted_revision = dataRevision();
+        }
+        return m_converted_values;
+    }
+
+    // content saved by older versions
+    auto values = dataPtr<std::vector<double>>();
+    return values ? *values : empty;
+}
+
+//! Returns minimum and maximum of values, or {0, 0} for empty content. The result is cached until
+//! the next content change.
+
+std::pair<double, double> Data2DItem::contentRange() const
+{
+    if (m_content_range_revision != dataRevision()) {
+        m_content_range = Utils::MinMax(contentRef());
+        m_content_range_revision = dataRevision();
+    }
+    return m_content_range;
+}
+
+//! Modifies the content in place by given function and notifies about data change once. Function
+//! shouldn't change the size of the content, it is intended to be used with operations from
+//! mvvm/utils/arrayutils.h. If undo/redo is enabled, the function is applied to the copy of the
+//! content, which then replaces the content as in setContent().
+
+void Data2DItem::updateContent(const std::function<void(std::vector<double>&)>& func)
+{
+    if (model() && model()->undoStack()) {
+        auto values = content();
+        func(values);
+        setContent(std::move(values));
+        return;
+    }
+
+    update_values(func);
+}
+
+//! Sets values of the rectangular region of bins. Data is stored row by row and its size should
+//! match the size of the region. Undo/redo, if enabled, stores only the values of the region.
+//! During the data change notification the region can be retrieved via changedRegion().
+
+void Data2DItem::setContentRegion(int x0, int y0, int width, int height,
+                                  const std::vector<double>& data)
+{
+    auto xaxis = xAxis();
+    auto yaxis = yAxis();
+    if (!xaxis || !yaxis || x0 < 0 || y0 < 0 || width < 0 || height < 0
+        || x0 + width > xaxis->size() || y0 + height > yaxis->size())
+        throw std::runtime_error("Data2DItem::setContentRegion() -> Region is outside of axes");
+
+    if (data.size() != static_cast<size_t>(width * height))
+        throw std::runtime_error(
+            "Data2DItem::setContentRegion() -> Data doesn't match size of region");
+
+    if (total_bin_count(this) != contentRef().size())
+        throw std::runtime_error(
+            "Data2DItem::setContentRegion() -> Content doesn't match size of axes");
+
+    if (data.empty())
+        return;
+
+    if (model()) {
+        model()->setContentRegion(this, x0, y0, width, height, data);
+    } else {
+        std::vector<double> values(data);
+        swap_region(Region{x0, y0, width, height}, values);
+    }
+}
+
+//! Returns the region of bins which is being changed. Outside of the notification caused by
+//! setContentRegion() the region covering all bins is returned.
+
+Data2DItem::Region Data2DItem::changedRegion() const
+{
+    if (m_changed_region.width > 0 && m_changed_region.height > 0)
+        return m_changed_region;
+
+    auto xaxis = xAxis();
+    auto yaxis = yAxis();
+    return xaxis && yaxis ? Region{0, 0, xaxis->size(), yaxis->size()} : Region();
 }
 
 //! Insert axis under given tag. Previous axis will be deleted and data points invalidated.
@@ -79,3 +217,34 @@ void Data2DItem::insert_axis(std::unique_ptr<BinnedAxisItem> axis, const std::st
 
     insertItem(axis.release(), {tag, 0});
 }
+
+//! Exchanges values of the region with the content of given vector and notifies about data change.
+
+void Data2DItem::swap_region(const Region& region, std::vector<double>& values)
+{
+    if (total_bin_count(this) != contentRef().size())
+        throw std::runtime_error("Data2DItem::swap_region() -> Content doesn't match size of axes");
+
+    const int nx = xAxis()->size();
+    auto swap_values = [&region, &values, nx](std::vector<double>& content) {
+        auto it = values.begin();
+        for (int iy = region.y; iy < region.y + region.height; ++iy) {
+            auto row = std::next(content.begin(), region.x + iy * nx);
+            it = std::swap_ranges(row, std::next(row, region.width), it);
+        }
+    };
+
+    m_changed_region = region;
+    update_values(swap_values);
+    m_changed_region = Region();
+}
+
+//! Modifies values in place by given function and notifies about data change. Content saved by
+//! older versions, or holding float32 or int32 numbers, is converted to float64 NumericArray first.
+
+void Data2DItem::update_values(const std::function<void(std::vector<double>&)>& func)
+{
+    upgrade_content(this);
+    m_converted_values = {};
+    updateData<NumericArray>([&func](NumericArray& array) { func(array.mutableValues<double>()); });
+}
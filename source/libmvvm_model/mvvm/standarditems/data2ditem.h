@@ -10,6 +10,7 @@
 #ifndef MVVM_STANDARDITEMS_DATA2DITEM_H
 #define MVVM_STANDARDITEMS_DATA2DITEM_H
 
+#include <functional>
 #include <mvvm/model/compounditem.h>
 #include <vector>
 
@@ -17,13 +18,17 @@ namespace ModelView
 {
 
 class BinnedAxisItem;
+class ContentRegionCommand;
 
 /*!
 @class Data2DItem
 @brief Represents two-dimensional data (axes definition and 2d array of values).
 
-Values are stored in Data2DItem itself, axes are attached as children. Corresponding plot
-properties will be served by ColorMapItem.
+Values are stored in Data2DItem itself as NumericArray of float64 numbers, axes are attached as
+children. Corresponding plot properties will be served by ColorMapItem. Values are stored row by
+row, i.e. the value of the bin (ix, iy) has index ix + iy*nx in the content vector. Content holding
+float32 or int32 numbers is read as converted to float64 and is replaced by float64 numbers on the
+first modification.
 */
 
 class CORE_EXPORT Data2DItem : public CompoundItem
@@ -31,6 +36,15 @@ class CORE_EXPORT Data2DItem : public CompoundItem
 public:
     static inline const std::string T_XAXIS = "T_XAXIS";
     static inline const std::string T_YAXIS = "T_YAXIS";
+
+    //! Rectangular region of bins.
+    struct Region {
+        int x{0};
+        int y{0};
+        int width{0};
+        int height{0};
+    };
+
     Data2DItem();
 
     void setAxes(std::unique_ptr<BinnedAxisItem> x_axis, std::unique_ptr<BinnedAxisItem> y_axis);
@@ -41,10 +55,31 @@ public:
 
     void setContent(const std::vector<double>& data);
 
+    void setContent(std::vector<double>&& data);
+
     std::vector<double> content() const;
 
+    const std::vector<double>& contentRef() const;
+
+    std::pair<double, double> contentRange() const;
+
+    void updateContent(const std::function<void(std::vector<double>&)>& func);
+
+    void setContentRegion(int x0, int y0, int width, int height, const std::vector<double>& data);
+
+    Region changedRegion() const;
+
 private:
+    friend class ContentRegionCommand;
     void insert_axis(std::unique_ptr<BinnedAxisItem> axis, const std::string& tag);
+    void swap_region(const Region& region, std::vector<double>& values);
+    void update_values(const std::function<void(std::vector<double>&)>& func);
+
+    Region m_changed_region; //!< region being notified, empty when the whole content is changed
+    mutable std::pair<double, double> m_content_range; //!< cached result of contentRange()
+    mutable int m_content_range_revision{-1}; //!< data revision for which m_content_range is valid
+    mutable std::vector<double> m_converted_values; //!< float64 copy of float32 or int32 content
+    mutable int m_converted_revision{-1}; //!< data revision for which m_converted_values is valid
 };
 
 } // namespace ModelView
@@ -45,3 +45,11 @@ std::vector<double> GraphItem::binValues() const
 {
     return dataItem() ? dataItem()->binValues() : std::vector<double>();
 }
+
+//! Returns reference to values of the linked data item without copying them.
+
+const std::vector<double>& GraphItem::binValuesRef() const
+{
+    static const std::vector<double> empty;
+    return dataItem() ? dataItem()->binValuesRef() : empty;
+}
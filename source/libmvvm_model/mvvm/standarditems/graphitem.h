@@ -40,6 +40,8 @@ public:
     std::vector<double> binCenters() const;
 
     std::vector<double> binValues() const;
+
+    const std::vector<double>& binValuesRef() const;
 };
 
 } // namespace ModelView
@@ -8,6 +8,9 @@
 // ************************************************************************** //
 
 #include <algorithm>
+#include <limits>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data1ditem.h>
 #include <mvvm/standarditems/graphitem.h>
 #include <mvvm/standarditems/graphviewportitem.h>
 #include <vector>
@@ -21,18 +24,27 @@ const double failback_min = 0.0;
 const double failback_max = 1.0;
 
 //! Find min and max values along all data points in all graphs.
-//! Function 'func' is used to run either through binCenters or binValues.
+//! Function 'func' returns the range of data points of Data1DItem either along x or y.
+//! Ranges are cached or computed in constant time, so the cost doesn't depend on number of points.
 
-template <typename T> auto get_min_max(std::vector<GraphItem*> graphs, T func)
+template <typename T> auto get_min_max(const std::vector<GraphItem*>& graphs, T func)
 {
-    std::vector<double> values;
+    size_t count(0);
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
     for (auto graph : graphs) {
-        const auto array = func(graph);
-        std::copy(std::begin(array), std::end(array), std::back_inserter(values));
+        auto data_item = graph->dataItem();
+        auto axis = data_item ? data_item->item<BinnedAxisItem>(Data1DItem::T_AXIS) : nullptr;
+        const size_t size = data_item ? data_item->binValuesRef().size() : 0;
+        if (size == 0 || !axis || axis->size() < 1)
+            continue;
+        auto [lower, upper] = func(data_item);
+        xmin = std::min(xmin, lower);
+        xmax = std::max(xmax, upper);
+        count += size;
     }
 
-    auto [xmin, xmax] = std::minmax_element(std::begin(values), std::end(values));
-    return xmin != xmax ? std::make_pair(*xmin, *xmax) : std::make_pair(failback_min, failback_max);
+    return count > 1 ? std::make_pair(xmin, xmax) : std::make_pair(failback_min, failback_max);
 }
 
 } // namespace
@@ -52,12 +64,16 @@ std::vector<GraphItem*> GraphViewportItem::graphItems() const
 
 std::pair<double, double> GraphViewportItem::data_xaxis_range() const
 {
-    return get_min_max(graphItems(), [](GraphItem* graph) { return graph->binCenters(); });
+    return get_min_max(graphItems(), [](Data1DItem* data_item) {
+        auto axis = data_item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
+        return std::make_pair(axis->front(), axis->back());
+    });
 }
 
 //! Returns lower, upper range on y-axis occupied by all data points of all graphs.
 
 std::pair<double, double> GraphViewportItem::data_yaxis_range() const
 {
-    return get_min_max(graphItems(), [](GraphItem* graph) { return graph->binValues(); });
+    return get_min_max(graphItems(),
+                       [](Data1DItem* data_item) { return data_item->valueRange(); });
 }
@@ -33,6 +33,7 @@ std::unique_ptr<ItemCatalogue> ModelView::CreateStandardItemCatalogue()
     result->registerItem<VectorItem>();
     result->registerItem<LinkedItem>();
     result->registerItem<FixedBinAxisItem>();
+    result->registerItem<VariableBinAxisItem>();
     result->registerItem<ViewportAxisItem>();
     result->registerItem<Data1DItem>();
     result->registerItem<Data2DItem>();
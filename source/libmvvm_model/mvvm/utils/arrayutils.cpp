@@ -0,0 +1,310 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mvvm/utils/arrayutils.h>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MVVM_ARRAYUTILS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(MVVM_ARRAYUTILS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define MVVM_ARRAYUTILS_AVX2
+#define MVVM_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+using namespace ModelView;
+
+namespace
+{
+
+enum class InstructionSet { SCALAR, SSE2, AVX2 };
+
+//! Returns the best instruction set supported by the processor, detected once.
+
+InstructionSet instruction_set()
+{
+    static const InstructionSet result = []() {
+#if defined(MVVM_ARRAYUTILS_AVX2)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return InstructionSet::AVX2;
+#endif
+#if defined(MVVM_ARRAYUTILS_SSE2)
+        return InstructionSet::SSE2;
+#else
+        return InstructionSet::SCALAR;
+#endif
+    }();
+    return result;
+}
+
+// Scalar kernels process elements [begin, end), they also handle tails of vectorized kernels.
+// Comparisons are written in the way which gives the same treatment of NaN in all kernels.
+
+void minmax_scalar(const double* data, size_t begin, size_t end, double& lower, double& upper)
+{
+    for (size_t i = begin; i < end; ++i) {
+        if (data[i] < lower)
+            lower = data[i];
+        if (data[i] > upper)
+            upper = data[i];
+    }
+}
+
+double sum_scalar(const double* data, size_t begin, size_t end)
+{
+    double result(0.0);
+    for (size_t i = begin; i < end; ++i)
+        result += data[i];
+    return result;
+}
+
+void affine_scalar(double* data, size_t begin, size_t end, double scale, double offset)
+{
+    for (size_t i = begin; i < end; ++i)
+        data[i] = data[i] * scale + offset;
+}
+
+void clamp_scalar(double* data, size_t begin, size_t end, double lower, double upper)
+{
+    for (size_t i = begin; i < end; ++i) {
+        if (data[i] < lower)
+            data[i] = lower;
+        else if (data[i] > upper)
+            data[i] = upper;
+    }
+}
+
+#if defined(MVVM_ARRAYUTILS_SSE2)
+
+// For min/max instructions the second operand is returned if any of operands is NaN.
+
+void minmax_sse2(const double* data, size_t size, double& lower, double& upper)
+{
+    __m128d vlower = _mm_set1_pd(lower);
+    __m128d vupper = _mm_set1_pd(upper);
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        const __m128d x = _mm_loadu_pd(data + i);
+        vlower = _mm_min_pd(x, vlower);
+        vupper = _mm_max_pd(x, vupper);
+    }
+    double buffer[2];
+    _mm_storeu_pd(buffer, vlower);
+    lower = std::min(buffer[0], buffer[1]);
+    _mm_storeu_pd(buffer, vupper);
+    upper = std::max(buffer[0], buffer[1]);
+    minmax_scalar(data, i, size, lower, upper);
+}
+
+double sum_sse2(const double* data, size_t size)
+{
+    __m128d vsum = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2)
+        vsum = _mm_add_pd(vsum, _mm_loadu_pd(data + i));
+    double buffer[2];
+    _mm_storeu_pd(buffer, vsum);
+    return buffer[0] + buffer[1] + sum_scalar(data, i, size);
+}
+
+void affine_sse2(double* data, size_t size, double scale, double offset)
+{
+    const __m128d vscale = _mm_set1_pd(scale);
+    const __m128d voffset = _mm_set1_pd(offset);
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2)
+        _mm_storeu_pd(data + i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(data + i), vscale), voffset));
+    affine_scalar(data, i, size, scale, offset);
+}
+
+void clamp_sse2(double* data, size_t size, double lower, double upper)
+{
+    const __m128d vlower = _mm_set1_pd(lower);
+    const __m128d vupper = _mm_set1_pd(upper);
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        const __m128d x = _mm_loadu_pd(data + i);
+        _mm_storeu_pd(data + i, _mm_min_pd(vupper, _mm_max_pd(vlower, x)));
+    }
+    clamp_scalar(data, i, size, lower, upper);
+}
+
+#endif
+
+#if defined(MVVM_ARRAYUTILS_AVX2)
+
+MVVM_TARGET_AVX2 void minmax_avx2(const double* data, size_t size, double& lower, double& upper)
+{
+    __m256d vlower = _mm256_set1_pd(lower);
+    __m256d vupper = _mm256_set1_pd(upper);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256d x = _mm256_loadu_pd(data + i);
+        vlower = _mm256_min_pd(x, vlower);
+        vupper = _mm256_max_pd(x, vupper);
+    }
+    double buffer[4];
+    _mm256_storeu_pd(buffer, vlower);
+    lower = std::min(std::min(buffer[0], buffer[1]), std::min(buffer[2], buffer[3]));
+    _mm256_storeu_pd(buffer, vupper);
+    upper = std::max(std::max(buffer[0], buffer[1]), std::max(buffer[2], buffer[3]));
+    minmax_scalar(data, i, size, lower, upper);
+}
+
+MVVM_TARGET_AVX2 double sum_avx2(const double* data, size_t size)
+{
+    __m256d vsum = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+        vsum = _mm256_add_pd(vsum, _mm256_loadu_pd(data + i));
+    double buffer[4];
+    _mm256_storeu_pd(buffer, vsum);
+    return (buffer[0] + buffer[1]) + (buffer[2] + buffer[3]) + sum_scalar(data, i, size);
+}
+
+MVVM_TARGET_AVX2 void affine_avx2(double* data, size_t size, double scale, double offset)
+{
+    // multiplication and addition are not fused to give the same result as the scalar code
+    const __m256d vscale = _mm256_set1_pd(scale);
+    const __m256d voffset = _mm256_set1_pd(offset);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256d x = _mm256_loadu_pd(data + i);
+        _mm256_storeu_pd(data + i, _mm256_add_pd(_mm256_mul_pd(x, vscale), voffset));
+    }
+    affine_scalar(data, i, size, scale, offset);
+}
+
+MVVM_TARGET_AVX2 void clamp_avx2(double* data, size_t size, double lower, double upper)
+{
+    const __m256d vlower = _mm256_set1_pd(lower);
+    const __m256d vupper = _mm256_set1_pd(upper);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256d x = _mm256_loadu_pd(data + i);
+        _mm256_storeu_pd(data + i, _mm256_min_pd(vupper, _mm256_max_pd(vlower, x)));
+    }
+    clamp_scalar(data, i, size, lower, upper);
+}
+
+#endif
+
+} // namespace
+
+std::pair<double, double> Utils::MinMax(const std::vector<double>& values)
+{
+    double lower = std::numeric_limits<double>::infinity();
+    double upper = -std::numeric_limits<double>::infinity();
+    switch (instruction_set()) {
+#if defined(MVVM_ARRAYUTILS_AVX2)
+    case InstructionSet::AVX2:
+        minmax_avx2(values.data(), values.size(), lower, upper);
+        break;
+#endif
+#if defined(MVVM_ARRAYUTILS_SSE2)
+    case InstructionSet::SSE2:
+        minmax_sse2(values.data(), values.size(), lower, upper);
+        break;
+#endif
+    default:
+        minmax_scalar(values.data(), 0, values.size(), lower, upper);
+    }
+    return lower > upper ? std::make_pair(0.0, 0.0) : std::make_pair(lower, upper);
+}
+
+double Utils::Sum(const std::vector<double>& values)
+{
+    switch (instruction_set()) {
+#if defined(MVVM_ARRAYUTILS_AVX2)
+    case InstructionSet::AVX2:
+        return sum_avx2(values.data(), values.size());
+#endif
+#if defined(MVVM_ARRAYUTILS_SSE2)
+    case InstructionSet::SSE2:
+        return sum_sse2(values.data(), values.size());
+#endif
+    default:
+        return sum_scalar(values.data(), 0, values.size());
+    }
+}
+
+void Utils::AffineTransform(std::vector<double>& values, double scale, double offset)
+{
+    switch (instruction_set()) {
+#if defined(MVVM_ARRAYUTILS_AVX2)
+    case InstructionSet::AVX2:
+        affine_avx2(values.data(), values.size(), scale, offset);
+        break;
+#endif
+#if defined(MVVM_ARRAYUTILS_SSE2)
+    case InstructionSet::SSE2:
+        affine_sse2(values.data(), values.size(), scale, offset);
+        break;
+#endif
+    default:
+        affine_scalar(values.data(), 0, values.size(), scale, offset);
+    }
+}
+
+void Utils::Log10(std::vector<double>& values, double floor)
+{
+    if (!(floor > 0.0))
+        throw std::runtime_error("Utils::Log10() -> Floor should be positive");
+
+    // there is no vectorized logarithm in the instruction sets, only the floor is vectorized
+    Clamp(values, floor, std::numeric_limits<double>::infinity());
+    for (auto& x : values)
+        x = std::log10(x);
+}
+
+void Utils::Clamp(std::vector<double>& values, double lower, double upper)
+{
+    if (lower > upper)
+        throw std::runtime_error("Utils::Clamp() -> Lower limit is greater than the upper one");
+
+    switch (instruction_set()) {
+#if defined(MVVM_ARRAYUTILS_AVX2)
+    case InstructionSet::AVX2:
+        clamp_avx2(values.data(), values.size(), lower, upper);
+        break;
+#endif
+#if defined(MVVM_ARRAYUTILS_SSE2)
+    case InstructionSet::SSE2:
+        clamp_sse2(values.data(), values.size(), lower, upper);
+        break;
+#endif
+    default:
+        clamp_scalar(values.data(), 0, values.size(), lower, upper);
+    }
+}
+
+std::vector<int> Utils::Histogram(const std::vector<double>& values, int nbins, double lower,
+                                  double upper)
+{
+    if (nbins < 1 || !(lower < upper))
+        throw std::runtime_error("Utils::Histogram() -> Invalid binning");
+
+    // bin index is data dependent, counting is done by the scalar code
+    std::vector<int> result(static_cast<size_t>(nbins), 0);
+    const double factor = nbins / (upper - lower);
+    for (auto x : values) {
+        if (!(x >= lower && x <= upper))
+            continue;
+        const int bin = std::min(static_cast<int>((x - lower) * factor), nbins - 1);
+        ++result[static_cast<size_t>(bin)];
+    }
+    return result;
+}
@@ -0,0 +1,52 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_UTILS_ARRAYUTILS_H
+#define MVVM_UTILS_ARRAYUTILS_H
+
+#include <mvvm/core/export.h>
+#include <utility>
+#include <vector>
+
+//! Numeric operations on large arrays of doubles, as stored in Data1DItem and Data2DItem.
+//! Operations use AVX2 or SSE2 instructions if they are supported by the processor,
+//! with the scalar code as a fallback.
+
+namespace ModelView
+{
+
+namespace Utils
+{
+
+//! Returns minimum and maximum of values, NaN values are ignored.
+//! Returns {0, 0} if there are no values to compare.
+CORE_EXPORT std::pair<double, double> MinMax(const std::vector<double>& values);
+
+//! Returns sum of values. Summation order, and hence rounding, depends on the instruction set.
+CORE_EXPORT double Sum(const std::vector<double>& values);
+
+//! Replaces every value x with scale*x + offset.
+CORE_EXPORT void AffineTransform(std::vector<double>& values, double scale, double offset);
+
+//! Replaces every value x with log10(x), values below the floor are replaced with log10(floor).
+CORE_EXPORT void Log10(std::vector<double>& values, double floor);
+
+//! Limits values to the interval [lower, upper]. NaN values are kept.
+CORE_EXPORT void Clamp(std::vector<double>& values, double lower, double upper);
+
+//! Returns number of values in each of nbins equal bins on the interval [lower, upper].
+//! Upper edge belongs to the last bin, values outside of the interval and NaN are not counted.
+CORE_EXPORT std::vector<int> Histogram(const std::vector<double>& values, int nbins, double lower,
+                                       double upper);
+
+} // namespace Utils
+
+} // namespace ModelView
+
+#endif // MVVM_UTILS_ARRAYUTILS_H
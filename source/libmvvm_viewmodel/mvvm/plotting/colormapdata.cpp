@@ -0,0 +1,56 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/plotting/colormapdata.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+ColorMapData::ColorMapData(int keySize, int valueSize, const QCPRange& keyRange,
+                           const QCPRange& valueRange)
+    : QCPColorMapData(keySize, valueSize, keyRange, valueRange)
+{
+}
+
+//! Constructs the data with the size, ranges and cells of other data.
+
+ColorMapData::ColorMapData(const QCPColorMapData& other) : QCPColorMapData(other) {}
+
+//! Copies count values to consecutive cells of the row, starting from the given cell.
+
+void ColorMapData::setRow(int keyIndex, int valueIndex, const double* values, int count)
+{
+    if (keyIndex < 0 || valueIndex < 0 || count < 0 || keyIndex + count > mKeySize
+        || valueIndex >= mValueSize)
+        throw std::runtime_error("ColorMapData::setRow() -> Cells are outside of colormap");
+
+    if (count == 0 || !mData)
+        return;
+
+    auto target = mData + static_cast<size_t>(valueIndex) * mKeySize + keyIndex;
+    for (int i = 0; i < count; ++i) {
+        const double z = values[i];
+        target[i] = z;
+        if (z < mDataBounds.lower)
+            mDataBounds.lower = z;
+        if (z > mDataBounds.upper)
+            mDataBounds.upper = z;
+    }
+    mDataModified = true;
+}
+
+//! Replaces the data of the colormap with ColorMapData holding the same cells. The colormap
+//! takes the ownership, the returned pointer stays valid until the colormap data is replaced.
+
+ColorMapData* ColorMapData::install(QCPColorMap* color_map)
+{
+    auto result = new ColorMapData(*color_map->data());
+    color_map->setData(result, /*copy*/ false);
+    return result;
+}
@@ -0,0 +1,41 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_PLOTTING_COLORMAPDATA_H
+#define MVVM_PLOTTING_COLORMAPDATA_H
+
+#include "qcustomplot.h"
+#include <mvvm/core/export.h>
+
+namespace ModelView
+{
+
+/*!
+@class ColorMapData
+@brief QCPColorMapData with filling of consecutive cells of a row in a single pass.
+
+Bounds are checked once per row, values are copied straight into the storage, data bounds are
+updated in the same pass. The class adds no data members, so QCPColorMap owning it deletes it
+correctly as QCPColorMapData.
+*/
+
+class CORE_EXPORT ColorMapData : public QCPColorMapData
+{
+public:
+    ColorMapData(int keySize, int valueSize, const QCPRange& keyRange, const QCPRange& valueRange);
+    explicit ColorMapData(const QCPColorMapData& other);
+
+    void setRow(int keyIndex, int valueIndex, const double* values, int count);
+
+    static ColorMapData* install(QCPColorMap* color_map);
+};
+
+} // namespace ModelView
+
+#endif // MVVM_PLOTTING_COLORMAPDATA_H
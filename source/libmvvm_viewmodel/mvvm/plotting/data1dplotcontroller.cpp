@@ -8,7 +8,11 @@
 // ************************************************************************** //
 
 #include "qcustomplot.h"
+#include <algorithm>
+#include <cmath>
 #include <mvvm/plotting/data1dplotcontroller.h>
+#include <mvvm/plotting/minmaxtree.h>
+#include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/data1ditem.h>
 
 namespace {
@@ -21,37 +25,193 @@ QVector<T> fromStdVector(const std::vector<T>& vec)
     return QVector<T>::fromStdVector(vec);
 #endif
 }
+
+//! Number of graph points per widget pixel, above which graph shows only the envelope of data.
+const int points_per_column = 4;
+
+//! Minimal number of graph points, which are always shown without decimation.
+const int min_points = 4096;
+
+//! Returns index of the bin containing given coordinate, clamped to the axis.
+int clamped_bin(const ModelView::BinnedAxisItem* axis, double x)
+{
+    auto [lower, upper] = axis->range();
+    if (x <= lower)
+        return 0;
+    if (x >= upper)
+        return axis->size() - 1;
+    return axis->findBin(x);
+}
 }
 
 using namespace ModelView;
 
 struct Data1DPlotController::Data1DPlotControllerImpl {
+    Data1DPlotController* master{nullptr};
     QCPGraph* m_graph{nullptr};
-    Data1DPlotControllerImpl(QCPGraph* graph) : m_graph(graph)
+    MinMaxTree tree;
+    bool is_decimated{false};
+    QCPRange envelope_range; //!< range of key axis for which envelope was calculated
+    int envelope_columns{0};
+    QMetaObject::Connection replot_connection;
+
+    Data1DPlotControllerImpl(Data1DPlotController* master, QCPGraph* graph)
+        : master(master), m_graph(graph)
     {
         if (!m_graph)
             throw std::runtime_error("Uninitialised graph in Data1DPlotController");
+
+        // envelope is checked on every replot, i.e. after zoom, pan or resize
+        replot_connection = QObject::connect(m_graph->parentPlot(), &QCustomPlot::beforeReplot,
+                                             [this]() { update_envelope(); });
     }
 
-    void update_graph_points(Data1DPlotController* controller)
+    ~Data1DPlotControllerImpl() { QObject::disconnect(replot_connection); }
+
+    Data1DItem* dataItem() { return master->currentItem(); }
+
+    //! Returns number of pixel columns available for the graph.
+
+    int columnCount() const { return std::max(m_graph->parentPlot()->viewport().width(), 1); }
+
+    //! Returns true if there are too many points to show them all.
+
+    bool is_decimation_needed(int npoints) const
+    {
+        return npoints > std::max(points_per_column * columnCount(), min_points);
+    }
+
+    void update_graph_points()
     {
-        auto data_item = controller->currentItem();
-        if (data_item) {
+        auto data_item = dataItem();
+        if (!data_item)
+            return;
+
+        const auto& values = data_item->binValuesRef();
+        auto axis = data_item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
+        is_decimated = axis && axis->size() == static_cast<int>(values.size())
+                       && is_decimation_needed(axis->size());
+        if (is_decimated) {
+            tree.reset(values);
+            show_envelope(data_item);
+        } else {
+            tree.reset({});
             m_graph->setData(fromStdVector<double>(data_item->binCenters()),
-                             fromStdVector<double>(data_item->binValues()));
-            m_graph->parentPlot()->replot();
+                             fromStdVector<double>(values));
+        }
+        m_graph->parentPlot()->replot();
+    }
+
+    //! Adds to the graph only points appended to the data item. Falls back to the full update
+    //! if the content was changed otherwise, or graph doesn't match data item.
+
+    void append_graph_points()
+    {
+        auto data_item = dataItem();
+        const int count = data_item ? data_item->appendedCount() : 0;
+        auto axis = data_item ? data_item->item<BinnedAxisItem>(Data1DItem::T_AXIS) : nullptr;
+        const int shown_count = is_decimated ? tree.size() : m_graph->dataCount();
+        const int nbins = static_cast<int>(data_item ? data_item->binValuesRef().size() : 0);
+        if (!count || !axis || shown_count + count != nbins
+            || (!is_decimated && is_decimation_needed(nbins))) {
+            update_graph_points();
+            return;
+        }
+
+        const auto& values = data_item->binValuesRef();
+        if (is_decimated) {
+            tree.append(values);
+            show_envelope(data_item);
+        } else {
+            QVector<double> keys, new_values;
+            keys.reserve(count);
+            new_values.reserve(count);
+            for (int index = nbins - count; index < nbins; ++index) {
+                keys.push_back(axis->binCenter(index));
+                new_values.push_back(values[static_cast<size_t>(index)]);
+            }
+            m_graph->addData(keys, new_values, /*alreadySorted*/ true);
         }
+        m_graph->parentPlot()->replot(QCustomPlot::rpQueuedReplot);
+    }
+
+    //! Shows on graph the envelope of data in the visible range of key axis. For every pixel
+    //! column, the first, minimal, maximal and last points of bins in the column are kept, in
+    //! their original order. Line drawn through these points covers the same pixels as the line
+    //! through all points. Closest points outside the visible range are kept too.
+
+    void show_envelope(Data1DItem* data_item)
+    {
+        const auto& values = data_item->binValuesRef();
+        auto axis = data_item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
+        const auto range = m_graph->keyAxis()->range();
+        const bool is_log = m_graph->keyAxis()->scaleType() == QCPAxis::stLogarithmic;
+        const int columns = columnCount();
+
+        auto column_edge = [&range, is_log, columns](int column) {
+            const double fraction = static_cast<double>(column) / columns;
+            return is_log ? range.lower * std::pow(range.upper / range.lower, fraction)
+                          : range.lower + (range.upper - range.lower) * fraction;
+        };
+
+        QVector<double> keys, new_values;
+        keys.reserve(4 * columns + 2);
+        new_values.reserve(4 * columns + 2);
+        int last_added(-1);
+        auto add_point = [&](int index) {
+            if (index == last_added)
+                return;
+            keys.push_back(axis->binCenter(index));
+            new_values.push_back(values[static_cast<size_t>(index)]);
+            last_added = index;
+        };
+
+        const int nbins = axis->size();
+        int first = clamped_bin(axis, range.lower);
+        if (first > 0)
+            add_point(first - 1);
+        for (int column = 0; column < columns && first < nbins; ++column) {
+            const int last = clamped_bin(axis, column_edge(column + 1));
+            if (last < first)
+                continue;
+            auto [imin, imax] = tree.findMinMax(values, first, last);
+            add_point(first);
+            add_point(std::min(imin, imax));
+            add_point(std::max(imin, imax));
+            add_point(last);
+            first = last + 1;
+        }
+        if (first < nbins)
+            add_point(first);
+
+        m_graph->setData(keys, new_values, /*alreadySorted*/ true);
+        envelope_range = range;
+        envelope_columns = columns;
+    }
+
+    //! Recalculates the envelope, if key axis range or widget size has changed.
+
+    void update_envelope()
+    {
+        auto data_item = dataItem();
+        if (!is_decimated || !data_item)
+            return;
+
+        if (m_graph->keyAxis()->range() != envelope_range || columnCount() != envelope_columns)
+            show_envelope(data_item);
     }
 
     void reset_graph()
     {
+        is_decimated = false;
+        tree.reset({});
         m_graph->setData(QVector<double>{}, QVector<double>{});
         m_graph->parentPlot()->replot();
     }
 };
 
 Data1DPlotController::Data1DPlotController(QCPGraph* graph)
-    : p_impl(std::make_unique<Data1DPlotControllerImpl>(graph))
+    : p_impl(std::make_unique<Data1DPlotControllerImpl>(this, graph))
 {
 }
 
@@ -59,10 +219,10 @@ Data1DPlotController::~Data1DPlotController() = default;
 
 void Data1DPlotController::subscribe()
 {
-    auto on_data_change = [this](SessionItem*, int) { p_impl->update_graph_points(this); };
+    auto on_data_change = [this](SessionItem*, int) { p_impl->append_graph_points(); };
     currentItem()->mapper()->setOnDataChange(on_data_change, this);
 
-    p_impl->update_graph_points(this);
+    p_impl->update_graph_points();
 }
 
 void Data1DPlotController::unsubscribe()
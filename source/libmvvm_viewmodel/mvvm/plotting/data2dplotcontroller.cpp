@@ -9,7 +9,9 @@
 
 #include "qcustomplot.h"
 #include <algorithm>
+#include <mvvm/plotting/colormapdata.h>
 #include <mvvm/plotting/data2dplotcontroller.h>
+#include <mvvm/plotting/data2dpyramid.h>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/data2ditem.h>
 
@@ -17,26 +19,103 @@ using namespace ModelView;
 
 namespace
 {
-//! Returns QCPRange of axis.
-QCPRange qcpRange(const BinnedAxisItem* axis)
+//! Number of colormap cells per widget pixel, above which coarser level of data is shown.
+const int cells_per_pixel = 2;
+
+//! Minimal number of colormap cells along each direction, which is always allowed.
+const int min_cells = 512;
+
+//! Rectangular window of the given level of data pyramid, which is shown on colormap.
+struct Window {
+    int level{0};
+    int x{0};
+    int y{0};
+    int width{0};
+    int height{0};
+    bool operator==(const Window& other) const
+    {
+        return level == other.level && x == other.x && y == other.y && width == other.width
+               && height == other.height;
+    }
+};
+
+//! Returns number of bins of given level of data pyramid, corresponding to given number of bins
+//! of original data.
+int bins_on_level(int nbins, int level)
+{
+    return (nbins + (1 << level) - 1) >> level;
+}
+
+//! Returns index of the bin containing given coordinate, clamped to the axis.
+int clamped_bin(const BinnedAxisItem* axis, double x)
+{
+    auto [lower, upper] = axis->range();
+    if (x <= lower)
+        return 0;
+    if (x >= upper)
+        return axis->size() - 1;
+    return axis->findBin(x);
+}
+
+//! Returns QCPRange of axis for bins [first, last] of the given level of data pyramid.
+QCPRange qcpRange(const BinnedAxisItem* axis, int level, int first, int last)
 {
-    auto centers = axis->binCenters(); // QCPColorMapData expects centers of bin
-    return centers.empty() ? QCPRange() : QCPRange(centers.front(), centers.back());
+    if (axis->size() < 1)
+        return QCPRange();
+
+    // QCPColorMapData expects centers of bin
+    auto center = [axis, level](int index) {
+        const int fine_first = index << level;
+        const int fine_last = std::min(fine_first + (1 << level), axis->size()) - 1;
+        return (axis->binCenter(fine_first) + axis->binCenter(fine_last)) / 2.0;
+    };
+    return QCPRange(center(first), center(last));
 }
 } // namespace
 
 struct Data2DPlotController::Data2DPlotControllerImpl {
     Data2DPlotController* master{nullptr};
     QCPColorMap* color_map{nullptr};
+    ColorMapData* map_data{nullptr}; //!< data installed into the colormap
+    Data2DPyramid pyramid;
+    Window window; //!< currently shown part of data
+    QMetaObject::Connection replot_connection;
+
     Data2DPlotControllerImpl(Data2DPlotController* master, QCPColorMap* color_map)
         : master(master), color_map(color_map)
     {
         if (!color_map)
             throw std::runtime_error("Uninitialised colormap in Data2DPlotController");
+
+        // level of detail is checked on every replot, i.e. after zoom, pan or resize
+        replot_connection = QObject::connect(color_map->parentPlot(), &QCustomPlot::beforeReplot,
+                                             [this]() { update_window(); });
     }
 
+    ~Data2DPlotControllerImpl() { QObject::disconnect(replot_connection); }
+
     Data2DItem* dataItem() { return master->currentItem(); }
 
+    //! Returns colormap data with row filling. It is installed again, if colormap data was
+    //! replaced from outside.
+
+    ColorMapData* data()
+    {
+        if (color_map->data() != map_data)
+            map_data = ColorMapData::install(color_map);
+        return map_data;
+    }
+
+    //! Returns true if data item has axes and content matching them.
+
+    bool is_valid(Data2DItem* data_item) const
+    {
+        if (!data_item || !data_item->xAxis() || !data_item->yAxis())
+            return false;
+        const auto nbins = data_item->xAxis()->size() * data_item->yAxis()->size();
+        return data_item->contentRef().size() == static_cast<size_t>(nbins);
+    }
+
     void update_data_points()
     {
         reset_colormap();
@@ -47,24 +126,153 @@ struct Data2DPlotController::Data2DPlotControllerImpl {
             if (xAxis && yAxis) {
                 const int nbinsx = xAxis->size();
                 const int nbinsy = yAxis->size();
+                pyramid.reset(nbinsx, nbinsy);
 
-                color_map->data()->setSize(nbinsx, nbinsy);
-                color_map->data()->setRange(qcpRange(xAxis), qcpRange(yAxis));
+                if (is_valid(data_item) && nbinsx > 0 && nbinsy > 0) {
+                    auto [min, max] = data_item->contentRange();
+                    color_map->setDataRange(QCPRange(min, max));
+                    show_window(data_item, visible_window(data_item));
+                } else {
+                    color_map->data()->setSize(nbinsx, nbinsy);
+                    color_map->data()->setRange(qcpRange(xAxis, 0, 0, nbinsx - 1),
+                                                qcpRange(yAxis, 0, 0, nbinsy - 1));
+                }
+            }
+        }
+        color_map->parentPlot()->replot();
+    }
 
-                auto values = data_item->content();
-                for (int ix = 0; ix < nbinsx; ++ix)
-                    for (int iy = 0; iy < nbinsy; ++iy)
-                        color_map->data()->setCell(ix, iy,
-                                                   values[static_cast<size_t>(ix + iy * nbinsx)]);
+    //! Updates only cells of the region which was changed. Falls back to the full update if the
+    //! whole content was changed, or colormap doesn't match data item. Data range is only extended
+    //! to include new values.
 
-                auto [min, max] = std::minmax_element(std::begin(values), std::end(values));
-                color_map->setDataRange(QCPRange(*min, *max));
-            }
+    void update_data_region()
+    {
+        auto data_item = dataItem();
+        if (!is_valid(data_item)) {
+            update_data_points();
+            return;
+        }
+
+        const int nbinsx = data_item->xAxis()->size();
+        const int nbinsy = data_item->yAxis()->size();
+        const auto region = data_item->changedRegion();
+        const bool is_partial = region.width < nbinsx || region.height < nbinsy;
+        if (!is_partial || window.width == 0 || pyramid.levelWidth(0) != nbinsx
+            || pyramid.levelHeight(0) != nbinsy) {
+            update_data_points();
+            return;
+        }
+
+        const auto& values = data_item->contentRef();
+        pyramid.updateRegion(values, region.x, region.y, region.width, region.height);
+
+        auto range = color_map->dataRange();
+        for (int iy = region.y; iy < region.y + region.height; ++iy) {
+            auto row = values.data() + static_cast<size_t>(iy * nbinsx);
+            for (int ix = region.x; ix < region.x + region.width; ++ix)
+                range.expand(row[ix]);
         }
+        color_map->setDataRange(range);
+
+        // cells of the shown window affected by the region
+        const int x0 = std::max(region.x >> window.level, window.x);
+        const int x1 = std::min((region.x + region.width - 1) >> window.level,
+                                window.x + window.width - 1);
+        const int y0 = std::max(region.y >> window.level, window.y);
+        const int y1 = std::min((region.y + region.height - 1) >> window.level,
+                                window.y + window.height - 1);
+        const auto& level_values = pyramid.level(values, window.level);
+        const int level_nbinsx = pyramid.levelWidth(window.level);
+        for (int iy = y0; x0 <= x1 && iy <= y1; ++iy) {
+            auto row = level_values.data() + static_cast<size_t>(iy * level_nbinsx);
+            data()->setRow(x0 - window.x, iy - window.y, row + x0, x1 - x0 + 1);
+        }
+
         color_map->parentPlot()->replot();
     }
 
-    void reset_colormap() { color_map->data()->clear(); }
+    //! Returns the part of data to show. The whole data is shown, if it fits into widget.
+    //! Otherwise, the coarsest level of data pyramid is selected, which still gives at least
+    //! cells_per_pixel cells per pixel in the visible range of viewport axes.
+
+    Window visible_window(Data2DItem* data_item)
+    {
+        auto xAxis = data_item->xAxis();
+        auto yAxis = data_item->yAxis();
+        const int nbinsx = xAxis->size();
+        const int nbinsy = yAxis->size();
+
+        auto viewport = color_map->parentPlot()->viewport();
+        const int max_cells_x = std::max(cells_per_pixel * viewport.width(), min_cells);
+        const int max_cells_y = std::max(cells_per_pixel * viewport.height(), min_cells);
+        if (nbinsx <= max_cells_x && nbinsy <= max_cells_y)
+            return Window{0, 0, 0, nbinsx, nbinsy};
+
+        auto key_range = color_map->keyAxis()->range();
+        auto value_range = color_map->valueAxis()->range();
+        int x0 = clamped_bin(xAxis, key_range.lower);
+        int x1 = clamped_bin(xAxis, key_range.upper);
+        int y0 = clamped_bin(yAxis, value_range.lower);
+        int y1 = clamped_bin(yAxis, value_range.upper);
+
+        int level(0);
+        while (level + 1 < pyramid.levelCount()
+               && (bins_on_level(x1 - x0 + 1, level) > max_cells_x
+                   || bins_on_level(y1 - y0 + 1, level) > max_cells_y))
+            ++level;
+
+        const int level_nbinsx = pyramid.levelWidth(level);
+        const int level_nbinsy = pyramid.levelHeight(level);
+        if (level_nbinsx <= max_cells_x && level_nbinsy <= max_cells_y)
+            return Window{level, 0, 0, level_nbinsx, level_nbinsy};
+
+        x0 >>= level;
+        x1 >>= level;
+        y0 >>= level;
+        y1 >>= level;
+        return Window{level, x0, y0, x1 - x0 + 1, y1 - y0 + 1};
+    }
+
+    //! Shows given part of data on colormap.
+
+    void show_window(Data2DItem* data_item, const Window& new_window)
+    {
+        const auto& values = pyramid.level(data_item->contentRef(), new_window.level);
+        const int level_nbinsx = pyramid.levelWidth(new_window.level);
+
+        data()->setSize(new_window.width, new_window.height);
+        data()->setRange(
+            qcpRange(data_item->xAxis(), new_window.level, new_window.x,
+                     new_window.x + new_window.width - 1),
+            qcpRange(data_item->yAxis(), new_window.level, new_window.y,
+                     new_window.y + new_window.height - 1));
+
+        for (int iy = 0; iy < new_window.height; ++iy) {
+            auto row = values.data() + static_cast<size_t>((iy + new_window.y) * level_nbinsx);
+            data()->setRow(0, iy, row + new_window.x, new_window.width);
+        }
+
+        window = new_window;
+    }
+
+    //! Updates shown part of data, if viewport or widget size requires it.
+
+    void update_window()
+    {
+        auto data_item = dataItem();
+        if (window.width == 0 || !is_valid(data_item))
+            return;
+
+        if (auto new_window = visible_window(data_item); !(new_window == window))
+            show_window(data_item, new_window);
+    }
+
+    void reset_colormap()
+    {
+        color_map->data()->clear();
+        window = Window();
+    }
 };
 
 Data2DPlotController::Data2DPlotController(QCPColorMap* color_map)
@@ -76,7 +284,7 @@ Data2DPlotController::~Data2DPlotController() = default;
 
 void Data2DPlotController::subscribe()
 {
-    auto on_data_change = [this](SessionItem*, int) { p_impl->update_data_points(); };
+    auto on_data_change = [this](SessionItem*, int) { p_impl->update_data_region(); };
     currentItem()->mapper()->setOnDataChange(on_data_change, this);
 
     p_impl->update_data_points();
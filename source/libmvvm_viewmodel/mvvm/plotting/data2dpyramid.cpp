@@ -0,0 +1,134 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <algorithm>
+#include <mvvm/plotting/data2dpyramid.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+//! Returns number of bins on the next level of pyramid.
+int reduced(int nbins)
+{
+    return (nbins + 1) / 2;
+}
+} // namespace
+
+Data2DPyramid::Data2DPyramid() = default;
+
+//! Sets the size of original data and invalidates all levels.
+
+void Data2DPyramid::reset(int nx, int ny)
+{
+    m_nx = nx;
+    m_ny = ny;
+    m_levels.clear();
+}
+
+//! Updates built levels after the change of the given region of original data.
+
+void Data2DPyramid::updateRegion(const std::vector<double>& data, int x, int y, int width,
+                                 int height)
+{
+    int x0 = x, y0 = y, x1 = x + width - 1, y1 = y + height - 1;
+    for (int level = 1; level <= static_cast<int>(m_levels.size()); ++level) {
+        x0 /= 2;
+        y0 /= 2;
+        x1 /= 2;
+        y1 /= 2;
+        const auto& source = level == 1 ? data : m_levels[static_cast<size_t>(level) - 2];
+        update_bins(source, m_levels[static_cast<size_t>(level) - 1], level, x0, y0, x1, y1);
+    }
+}
+
+//! Returns data of given level, building it and all previous levels if necessary.
+
+const std::vector<double>& Data2DPyramid::level(const std::vector<double>& data, int level)
+{
+    if (level < 0 || level >= levelCount())
+        throw std::runtime_error("Data2DPyramid::level() -> Level doesn't exist");
+
+    if (level == 0)
+        return data;
+
+    for (int index = static_cast<int>(m_levels.size()) + 1; index <= level; ++index)
+        build_level(index == 1 ? data : m_levels.back(), index);
+
+    return m_levels[static_cast<size_t>(level) - 1];
+}
+
+//! Returns number of levels, including the original data. The last level consists of single bin.
+
+int Data2DPyramid::levelCount() const
+{
+    if (m_nx < 1 || m_ny < 1)
+        return 1;
+
+    int result(1);
+    for (int nx = m_nx, ny = m_ny; nx > 1 || ny > 1; nx = reduced(nx), ny = reduced(ny))
+        ++result;
+    return result;
+}
+
+//! Returns number of bins along x on given level.
+
+int Data2DPyramid::levelWidth(int level) const
+{
+    int result = m_nx;
+    for (int index = 0; index < level; ++index)
+        result = reduced(result);
+    return result;
+}
+
+//! Returns number of bins along y on given level.
+
+int Data2DPyramid::levelHeight(int level) const
+{
+    int result = m_ny;
+    for (int index = 0; index < level; ++index)
+        result = reduced(result);
+    return result;
+}
+
+//! Builds given level from the source, representing the previous level.
+
+void Data2DPyramid::build_level(const std::vector<double>& source, int level)
+{
+    std::vector<double> result(static_cast<size_t>(levelWidth(level) * levelHeight(level)));
+    update_bins(source, result, level, 0, 0, levelWidth(level) - 1, levelHeight(level) - 1);
+    m_levels.push_back(std::move(result));
+}
+
+//! Recalculates bins of target in the range [x0, x1], [y0, y1] from the source. Target and source
+//! represent given and previous levels.
+
+void Data2DPyramid::update_bins(const std::vector<double>& source, std::vector<double>& target,
+                                int level, int x0, int y0, int x1, int y1) const
+{
+    const int source_nx = levelWidth(level - 1);
+    const int source_ny = levelHeight(level - 1);
+    const int nx = levelWidth(level);
+
+    for (int iy = y0; iy <= y1; ++iy) {
+        const int sy0 = 2 * iy;
+        const int sy1 = std::min(sy0 + 1, source_ny - 1);
+        for (int ix = x0; ix <= x1; ++ix) {
+            const int sx0 = 2 * ix;
+            const int sx1 = std::min(sx0 + 1, source_nx - 1);
+            double sum(0.0);
+            for (int sy = sy0; sy <= sy1; ++sy)
+                for (int sx = sx0; sx <= sx1; ++sx)
+                    sum += source[static_cast<size_t>(sx + sy * source_nx)];
+            const int count = (sx1 - sx0 + 1) * (sy1 - sy0 + 1);
+            target[static_cast<size_t>(ix + iy * nx)] = sum / count;
+        }
+    }
+}
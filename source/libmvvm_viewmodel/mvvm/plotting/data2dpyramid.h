@@ -0,0 +1,58 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_PLOTTING_DATA2DPYRAMID_H
+#define MVVM_PLOTTING_DATA2DPYRAMID_H
+
+#include <mvvm/core/export.h>
+#include <vector>
+
+namespace ModelView
+{
+
+/*!
+@class Data2DPyramid
+@brief Multi-resolution representation of two-dimensional data.
+
+Level 0 is the original data, stored row by row, which is owned by the caller and passed to
+methods by reference. Every next level has twice less bins along each direction, the value of
+its bin is the average of up to four bins of the previous level. Levels are built on first
+request and are updated incrementally on region changes of the original data.
+*/
+
+class CORE_EXPORT Data2DPyramid
+{
+public:
+    Data2DPyramid();
+
+    void reset(int nx, int ny);
+
+    void updateRegion(const std::vector<double>& data, int x, int y, int width, int height);
+
+    const std::vector<double>& level(const std::vector<double>& data, int level);
+
+    int levelCount() const;
+
+    int levelWidth(int level) const;
+
+    int levelHeight(int level) const;
+
+private:
+    void build_level(const std::vector<double>& source, int level);
+    void update_bins(const std::vector<double>& source, std::vector<double>& target, int level,
+                     int x0, int y0, int x1, int y1) const;
+
+    int m_nx{0};
+    int m_ny{0};
+    std::vector<std::vector<double>> m_levels; //!< built levels starting from the level 1
+};
+
+} // namespace ModelView
+
+#endif // MVVM_PLOTTING_DATA2DPYRAMID_H
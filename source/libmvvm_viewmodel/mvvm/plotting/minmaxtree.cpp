@@ -0,0 +1,128 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/plotting/minmaxtree.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+//! Returns index of smaller value, or the smaller index in the case of equal values.
+//! Negative indices correspond to empty nodes.
+int min_index(const std::vector<double>& data, int a, int b)
+{
+    if (a < 0)
+        return b;
+    if (b < 0)
+        return a;
+    const double va = data[static_cast<size_t>(a)];
+    const double vb = data[static_cast<size_t>(b)];
+    return vb < va || (vb == va && b < a) ? b : a;
+}
+
+//! Returns index of larger value, or the smaller index in the case of equal values.
+int max_index(const std::vector<double>& data, int a, int b)
+{
+    if (a < 0)
+        return b;
+    if (b < 0)
+        return a;
+    const double va = data[static_cast<size_t>(a)];
+    const double vb = data[static_cast<size_t>(b)];
+    return vb > va || (vb == va && b < a) ? b : a;
+}
+} // namespace
+
+MinMaxTree::MinMaxTree() = default;
+
+//! Builds the tree for given data.
+
+void MinMaxTree::reset(const std::vector<double>& data)
+{
+    m_size = static_cast<int>(data.size());
+    m_capacity = 1;
+    while (m_capacity < m_size)
+        m_capacity *= 2;
+
+    m_min.assign(static_cast<size_t>(2 * m_capacity), -1);
+    m_max.assign(static_cast<size_t>(2 * m_capacity), -1);
+    for (int index = 0; index < m_size; ++index) {
+        m_min[static_cast<size_t>(m_capacity + index)] = index;
+        m_max[static_cast<size_t>(m_capacity + index)] = index;
+    }
+    for (int node = m_capacity - 1; node > 0; --node)
+        update_node(data, node);
+}
+
+//! Updates the tree after values were appended to the end of data. The tree is rebuilt if new
+//! values don't fit into its capacity.
+
+void MinMaxTree::append(const std::vector<double>& data)
+{
+    const int new_size = static_cast<int>(data.size());
+    if (new_size < m_size)
+        throw std::runtime_error("MinMaxTree::append() -> Data is shorter than the tree");
+
+    if (new_size > m_capacity) {
+        reset(data);
+        return;
+    }
+
+    for (int index = m_size; index < new_size; ++index) {
+        int node = m_capacity + index;
+        m_min[static_cast<size_t>(node)] = index;
+        m_max[static_cast<size_t>(node)] = index;
+        for (node /= 2; node > 0; node /= 2)
+            update_node(data, node);
+    }
+    m_size = new_size;
+}
+
+//! Returns indices of minimum and maximum values in the range [first, last] of data.
+
+std::pair<int, int> MinMaxTree::findMinMax(const std::vector<double>& data, int first,
+                                           int last) const
+{
+    if (first < 0 || last >= m_size || first > last)
+        throw std::runtime_error("MinMaxTree::findMinMax() -> Invalid range");
+
+    int imin(-1), imax(-1);
+    for (int left = first + m_capacity, right = last + m_capacity + 1; left < right;
+         left /= 2, right /= 2) {
+        if (left & 1) {
+            imin = min_index(data, imin, m_min[static_cast<size_t>(left)]);
+            imax = max_index(data, imax, m_max[static_cast<size_t>(left)]);
+            ++left;
+        }
+        if (right & 1) {
+            --right;
+            imin = min_index(data, imin, m_min[static_cast<size_t>(right)]);
+            imax = max_index(data, imax, m_max[static_cast<size_t>(right)]);
+        }
+    }
+    return {imin, imax};
+}
+
+//! Returns number of data values in the tree.
+
+int MinMaxTree::size() const
+{
+    return m_size;
+}
+
+//! Recalculates given node from its children.
+
+void MinMaxTree::update_node(const std::vector<double>& data, int node)
+{
+    const auto left = static_cast<size_t>(2 * node);
+    const auto right = left + 1;
+    m_min[static_cast<size_t>(node)] = min_index(data, m_min[left], m_min[right]);
+    m_max[static_cast<size_t>(node)] = max_index(data, m_max[left], m_max[right]);
+}
@@ -0,0 +1,53 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_PLOTTING_MINMAXTREE_H
+#define MVVM_PLOTTING_MINMAXTREE_H
+
+#include <mvvm/core/export.h>
+#include <utility>
+#include <vector>
+
+namespace ModelView
+{
+
+/*!
+@class MinMaxTree
+@brief Segment tree to find positions of minimum and maximum values in the range of data.
+
+Data is owned by the caller and passed to methods by reference. Tree is built in O(N), the
+query for any range takes O(log N). Values appended to the end of data are added in O(log N)
+per value, as long as they fit into current capacity of the tree.
+*/
+
+class CORE_EXPORT MinMaxTree
+{
+public:
+    MinMaxTree();
+
+    void reset(const std::vector<double>& data);
+
+    void append(const std::vector<double>& data);
+
+    std::pair<int, int> findMinMax(const std::vector<double>& data, int first, int last) const;
+
+    int size() const;
+
+private:
+    void update_node(const std::vector<double>& data, int node);
+
+    int m_size{0};
+    int m_capacity{0};      //!< number of leaves, power of two
+    std::vector<int> m_min; //!< index of minimum value for every node, leaves start at capacity
+    std::vector<int> m_max; //!< index of maximum value for every node
+};
+
+} // namespace ModelView
+
+#endif // MVVM_PLOTTING_MINMAXTREE_H
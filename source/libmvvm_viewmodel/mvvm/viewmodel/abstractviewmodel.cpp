@@ -7,19 +7,51 @@
 //
 // ************************************************************************** //
 
+#include <algorithm>
+#include <functional>
 #include <mvvm/viewmodel/abstractviewmodel.h>
 #include <mvvm/viewmodel/abstractviewmodelcontroller.h>
 #include <mvvm/viewmodel/viewitems.h>
-#include <mvvm/viewmodel/viewmodelutils.h>
 
 using namespace ModelView;
 
+namespace
+{
+
+//! Calls the function for all items in given rows of the parent and for all their descendants.
+
+void iterate_rows(const QStandardItem* parent, int first, int last,
+                  const std::function<void(QStandardItem*)>& fun)
+{
+    for (int row = first; row <= last; ++row) {
+        for (int col = 0; col < parent->columnCount(); ++col) {
+            if (auto child = parent->child(row, col)) {
+                fun(child);
+                if (child->hasChildren())
+                    iterate_rows(child, 0, child->rowCount() - 1, fun);
+            }
+        }
+    }
+}
+
+} // namespace
+
 AbstractViewModel::AbstractViewModel(std::unique_ptr<AbstractViewModelController> controller,
                                      QObject* parent)
     : QStandardItemModel(parent), m_controller(std::move(controller))
 {
     m_controller->setViewModel(this);
     setItemPrototype(new ViewEmptyItem);
+
+    connect(this, &QStandardItemModel::rowsInserted,
+            [this](const QModelIndex& parent, int first, int last) {
+                register_views(parent, first, last);
+            });
+    connect(this, &QStandardItemModel::rowsAboutToBeRemoved,
+            [this](const QModelIndex& parent, int first, int last) {
+                unregister_views(parent, first, last);
+            });
+    connect(this, &QStandardItemModel::modelAboutToBeReset, [this]() { m_views.clear(); });
 }
 
 AbstractViewModel::~AbstractViewModel() = default;
@@ -70,9 +102,12 @@ std::vector<QStandardItem*> AbstractViewModel::findStandardViews(const SessionIt
     return result;
 }
 
+//! Returns vector of views used to display given SessionItem, in the order of their insertion.
+
 std::vector<ViewItem*> AbstractViewModel::findViews(const SessionItem* item) const
 {
-    return Utils::findViews(this, item, QModelIndex());
+    auto it = m_views.find(item);
+    return it == m_views.end() ? std::vector<ViewItem*>() : it->second;
 }
 
 //! Returns SessionItem corresponding to given QModelIndex.
@@ -107,3 +142,123 @@ ViewItem* AbstractViewModel::viewItemFromIndex(const QModelIndex& index) const
 {
     return dynamic_cast<ViewItem*>(itemFromIndex(index));
 }
+
+//! Returns true if rows of children are constructed on fetchMore request only.
+
+bool AbstractViewModel::isLazyMode() const
+{
+    return m_controller->isLazyMode();
+}
+
+//! Sets the interval in msec for reporting data changes of SessionItems. Negative interval means
+//! that every change is reported immediately.
+
+void AbstractViewModel::setUpdateInterval(int msec)
+{
+    m_controller->setUpdateInterval(msec);
+}
+
+//! Reports data changes collected so far.
+
+void AbstractViewModel::flushDataChanges()
+{
+    m_controller->flushDataChanges();
+}
+
+//! Sets the number of top level rows to construct per event loop iteration. Zero means that
+//! the whole view model is constructed at once.
+
+void AbstractViewModel::setConstructionChunkSize(int rows)
+{
+    m_controller->setConstructionChunkSize(rows);
+}
+
+//! Returns true if construction of top level rows is still in progress.
+
+bool AbstractViewModel::isConstructing() const
+{
+    return m_controller->isConstructing();
+}
+
+//! Sets the filter to hide rows of items, for which the function returns false.
+
+void AbstractViewModel::setFilter(std::function<bool(const SessionItem*)> filter)
+{
+    m_controller->setFilter(std::move(filter));
+}
+
+//! Sets the function to calculate sort keys of items. Rows are sorted by keys of their items.
+
+void AbstractViewModel::setSortKey(std::function<QVariant(const SessionItem*)> sort_key,
+                                   Qt::SortOrder order)
+{
+    m_controller->setSortKey(std::move(sort_key), order);
+}
+
+//! Returns true if parent has children, including children which rows are not constructed yet.
+
+bool AbstractViewModel::hasChildren(const QModelIndex& parent) const
+{
+    return canFetchMore(parent) || QStandardItemModel::hasChildren(parent);
+}
+
+bool AbstractViewModel::canFetchMore(const QModelIndex& parent) const
+{
+    if (parent.column() > 0)
+        return false;
+
+    auto item = sessionItemFromIndex(parent);
+    return item && m_controller->canFetchMore(item);
+}
+
+//! Constructs rows of children of given parent in lazy mode.
+
+void AbstractViewModel::fetchMore(const QModelIndex& parent)
+{
+    if (auto item = sessionItemFromIndex(parent); item && parent.column() <= 0)
+        m_controller->fetchMore(item);
+}
+
+//! Removes rows of children of given parent in lazy mode. They will be constructed again on
+//! next fetchMore request.
+
+void AbstractViewModel::releaseChildren(const QModelIndex& parent)
+{
+    if (auto item = sessionItemFromIndex(parent); item && parent.column() <= 0)
+        m_controller->releaseChildren(item);
+}
+
+//! Returns QStandardItem corresponding to the given parent index.
+
+QStandardItem* AbstractViewModel::parentItem(const QModelIndex& parent) const
+{
+    return parent.isValid() ? itemFromIndex(parent) : invisibleRootItem();
+}
+
+//! Adds views located in given rows of the parent, and all their descendants, to the index.
+
+void AbstractViewModel::register_views(const QModelIndex& parent, int first, int last)
+{
+    iterate_rows(parentItem(parent), first, last, [this](QStandardItem* standard_item) {
+        if (auto view = dynamic_cast<ViewItem*>(standard_item))
+            m_views[view->item()].push_back(view);
+    });
+}
+
+//! Removes views located in given rows of the parent, and all their descendants, from the index.
+
+void AbstractViewModel::unregister_views(const QModelIndex& parent, int first, int last)
+{
+    iterate_rows(parentItem(parent), first, last, [this](QStandardItem* standard_item) {
+        auto view = dynamic_cast<ViewItem*>(standard_item);
+        if (!view)
+            return;
+        auto it = m_views.find(view->item());
+        if (it == m_views.end())
+            return;
+        auto& views = it->second;
+        views.erase(std::remove(views.begin(), views.end(), view), views.end());
+        if (views.empty())
+            m_views.erase(it);
+    });
+}
@@ -11,8 +11,11 @@
 #define MVVM_VIEWMODEL_ABSTRACTVIEWMODEL_H
 
 #include <QStandardItemModel>
+#include <functional>
 #include <memory>
 #include <mvvm/core/export.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ModelView
 {
@@ -38,13 +41,27 @@ of SessionItem.
 AbstractViewModel is not intended for insert/remove through QStandardItemModel interface.
 Everything should be done through SessionModel.
 
-AbstractViewModel uses simplified mechanism of syncronization with SessionModel.
-Every time some SessionItem is removed from SessionModel, in ViewModel we remove corersponding
-ViewItem _together_ with all its siblings, and then regenerate corresponding parent's branch.
+On insert/remove of SessionItem in SessionModel, AbstractViewModel inserts/removes the single
+row, corresponding to the item. The row is found through children strategy. If rows of the
+parent's branch can't be mapped to children reported by the strategy, all ViewItems of the
+branch are removed and the branch is regenerated.
+
+AbstractViewModel keeps the index of ViewItems for every SessionItem shown. The index is updated
+on every row insert/remove, so the search of views of the given item doesn't require traversal
+of the whole view model.
+
+With construction chunk size set, top level rows are constructed in portions on consecutive
+iterations of the event loop, reporting the progress with constructionProgress signal, so the
+construction of the view model for a large SessionModel doesn't freeze the GUI.
+
+Rows can be filtered and sorted by data of SessionItems directly, without QSortFilterProxyModel
+on top. Keys are cached, and only rows of items with changed keys are moved on data change.
 */
 
 class CORE_EXPORT AbstractViewModel : public QStandardItemModel
 {
+    Q_OBJECT
+
 public:
     friend class AbstractViewModelController; // FIXME remove friendship
     AbstractViewModel(std::unique_ptr<AbstractViewModelController> controller,
@@ -63,6 +80,32 @@ public:
 
     ViewItem* viewItemFromIndex(const QModelIndex& index) const;
 
+    bool isLazyMode() const;
+
+    void setUpdateInterval(int msec);
+
+    void flushDataChanges();
+
+    void setConstructionChunkSize(int rows);
+
+    bool isConstructing() const;
+
+    void setFilter(std::function<bool(const SessionItem*)> filter);
+
+    void setSortKey(std::function<QVariant(const SessionItem*)> sort_key,
+                    Qt::SortOrder order = Qt::AscendingOrder);
+
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+    bool canFetchMore(const QModelIndex& parent) const override;
+
+    void fetchMore(const QModelIndex& parent) override;
+
+    void releaseChildren(const QModelIndex& parent);
+
+signals:
+    void constructionProgress(int constructed_rows, int total_rows);
+
 protected:
     QStandardItem* rootViewItem() const;
     SessionModel* sessionModel() const;
@@ -73,7 +116,12 @@ private:
     std::vector<QStandardItem*> findStandardViews(const SessionItem* item) const;
     std::vector<ViewItem*> findViews(const SessionItem* item) const;
 
+    QStandardItem* parentItem(const QModelIndex& parent) const;
+    void register_views(const QModelIndex& parent, int first, int last);
+    void unregister_views(const QModelIndex& parent, int first, int last);
+
     std::unique_ptr<AbstractViewModelController> m_controller;
+    std::unordered_map<const SessionItem*, std::vector<ViewItem*>> m_views;
 };
 
 } // namespace ModelView
@@ -7,15 +7,22 @@
 //
 // ************************************************************************** //
 
+#include <QTimer>
+#include <algorithm>
+#include <map>
+#include <mvvm/model/itemutils.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/signals/modelmapper.h>
 #include <mvvm/viewmodel/abstractviewmodel.h>
 #include <mvvm/viewmodel/abstractviewmodelcontroller.h>
+#include <mvvm/viewmodel/cachedchildrenstrategy.h>
 #include <mvvm/viewmodel/childrenstrategyinterface.h>
 #include <mvvm/viewmodel/rowstrategyinterface.h>
 #include <mvvm/viewmodel/viewitem.h>
 #include <mvvm/viewmodel/viewmodelutils.h>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace
 {
@@ -30,6 +37,35 @@ bool isValidItemRole(const ModelView::ViewItem* view, int item_role)
         return true;
     return false;
 }
+
+//! Returns true if the row starting from the given cell is representing given item. The cell is
+//! either the view of the item itself, or the view of one of its children. The item of the cell
+//! is compared by pointer only, since it can be already deleted.
+bool isRowOfItem(QStandardItem* cell, const ModelView::SessionItem* item)
+{
+    auto view = dynamic_cast<ModelView::ViewItem*>(cell);
+    if (!view)
+        return false;
+    auto view_item = view->item();
+    return view_item == item || item->tagRowOfItem(view_item).row != -1;
+}
+
+//! Adds Qt roles to the list of changed roles. Empty list means that all roles have changed.
+void mergeRoles(QVector<int>& roles, const QVector<int>& other)
+{
+    if (roles.empty())
+        return;
+
+    if (other.empty()) {
+        roles.clear();
+        return;
+    }
+
+    for (auto role : other)
+        if (!roles.contains(role))
+            roles.push_back(role);
+}
+
 } // namespace
 
 using namespace ModelView;
@@ -45,13 +81,26 @@ struct AbstractViewModelController::AbstractViewModelControllerImpl {
         return m_row_strategy->constructRow(item);
     }
 
-    std::vector<SessionItem*> item_children(const SessionItem* item) const
+    const std::vector<SessionItem*>& item_children(const SessionItem* item) const
     {
-        return m_children_strategy->children(item);
+        return m_children_strategy->cachedChildren(item);
+    }
+
+    //! Returns position of the child among children of the parent, or -1 if it is absent.
+
+    int child_row(const SessionItem* parent, const SessionItem* child) const
+    {
+        return m_children_strategy->childRow(parent, child);
     }
 
     void reset_view_model()
     {
+        if (m_children_strategy)
+            m_children_strategy->clear();
+        if (m_construction_timer)
+            m_construction_timer->stop();
+        m_is_constructing = false;
+        m_pending_changes.clear();
         m_view_model->clear();
     }
 
@@ -64,11 +113,130 @@ struct AbstractViewModelController::AbstractViewModelControllerImpl {
         return m_view_model->findStandardViews(item);
     }
 
+    //! Returns the view of the parent, which rows are representing given children of the parent,
+    //! excluding the one given by the pointer. Returns nullptr if rows can't be mapped to
+    //! children.
+
+    QStandardItem* mappedView(SessionItem* parent, const std::vector<SessionItem*>& children,
+                              const SessionItem* excluded)
+    {
+        auto views = findStandardViews(parent);
+        if (views.empty())
+            return nullptr;
+
+        for (size_t index = 1; index < views.size(); ++index)
+            if (views[index]->hasChildren())
+                return nullptr;
+
+        auto view = views.front();
+        int row(0);
+        for (auto child : children) {
+            if (child == excluded)
+                continue;
+            if (row >= view->rowCount() || !isRowOfItem(view->child(row), child))
+                return nullptr;
+            ++row;
+        }
+        return row == view->rowCount() ? view : nullptr;
+    }
+
     AbstractViewModel* m_view_model;
     SessionItem* m_root_item;
     SessionModel* m_session_model;
-    std::unique_ptr<ChildrenStrategyInterface> m_children_strategy;
+    std::unique_ptr<CachedChildrenStrategy> m_children_strategy;
     std::unique_ptr<RowStrategyInterface> m_row_strategy;
+    SessionItem* m_rebuild_parent{nullptr}; //!< parent which branch is rebuilt after removal
+    bool m_lazy_mode{false};
+    std::unordered_set<const SessionItem*> m_unfetched; //!< items with children to construct
+
+    //! Marks item as having children to construct, or content to load, on request.
+
+    void mark_unfetched(const SessionItem* item)
+    {
+        if (item_children(item).empty() && !m_session_model->canFetchItem(item))
+            m_unfetched.erase(item);
+        else
+            m_unfetched.insert(item);
+    }
+
+    bool is_unfetched(const SessionItem* item) const
+    {
+        return m_unfetched.find(item) != m_unfetched.end();
+    }
+
+    int m_chunk_size{0};       //!< number of top level rows to construct at once
+    int m_constructed_rows{0}; //!< number of children of the root already processed
+    bool m_is_constructing{false};
+    std::unique_ptr<QTimer> m_construction_timer;
+
+    int m_update_interval{-1};
+    std::unique_ptr<QTimer> m_update_timer;
+    std::unordered_map<ViewItem*, QVector<int>> m_pending_changes; //!< views and changed roles
+
+    //! Collects data change of the view to report it later, and schedules the report.
+
+    void add_data_change(ViewItem* view, const QVector<int>& roles)
+    {
+        auto [it, inserted] = m_pending_changes.emplace(view, roles);
+        if (!inserted)
+            mergeRoles(it->second, roles);
+
+        if (!m_update_timer) {
+            m_update_timer = std::make_unique<QTimer>();
+            m_update_timer->setSingleShot(true);
+            QObject::connect(m_update_timer.get(), &QTimer::timeout,
+                             [this]() { flush_data_changes(); });
+        }
+
+        if (!m_update_timer->isActive())
+            m_update_timer->start(m_update_interval);
+    }
+
+    //! Reports collected data changes. Changed views of the same parent are grouped into
+    //! rectangles of consecutive rows, with a single dataChanged signal per rectangle.
+
+    void flush_data_changes()
+    {
+        if (m_update_timer)
+            m_update_timer->stop();
+
+        if (m_pending_changes.empty())
+            return;
+
+        // first and last changed columns of rows, and changed roles, for every parent
+        std::map<QStandardItem*, std::map<int, std::pair<int, int>>> parent_rows;
+        std::map<QStandardItem*, QVector<int>> parent_roles;
+        for (const auto& [view, roles] : m_pending_changes) {
+            auto parent = view->parent();
+            auto [columns, inserted] = parent_rows[parent].emplace(
+                view->row(), std::make_pair(view->column(), view->column()));
+            if (!inserted) {
+                columns->second.first = std::min(columns->second.first, view->column());
+                columns->second.second = std::max(columns->second.second, view->column());
+            }
+            auto [parent_role, is_new] = parent_roles.emplace(parent, roles);
+            if (!is_new)
+                mergeRoles(parent_role->second, roles);
+        }
+        m_pending_changes.clear();
+
+        for (const auto& [parent, rows] : parent_rows) {
+            auto parent_index = parent ? parent->index() : QModelIndex();
+            const auto& roles = parent_roles[parent];
+            for (auto it = rows.begin(); it != rows.end();) {
+                int first_row = it->first, last_row = it->first;
+                auto [first_column, last_column] = it->second;
+                for (++it; it != rows.end() && it->first == last_row + 1; ++it) {
+                    last_row = it->first;
+                    first_column = std::min(first_column, it->second.first);
+                    last_column = std::max(last_column, it->second.second);
+                }
+                m_view_model->dataChanged(
+                    m_view_model->index(first_row, first_column, parent_index),
+                    m_view_model->index(last_row, last_column, parent_index), roles);
+            }
+        }
+    }
 };
 
 AbstractViewModelController::AbstractViewModelController(AbstractViewModel* view_model)
@@ -103,6 +271,11 @@ void AbstractViewModelController::setSessionModel(SessionModel* model)
         };
         sessionModel()->mapper()->setOnItemInserted(on_item_inserted, this);
 
+        auto on_about_to_remove = [this](SessionItem* item, TagRow tagrow) {
+            onItemAboutToBeRemoved(item, tagrow);
+        };
+        sessionModel()->mapper()->setOnAboutToRemoveItem(on_about_to_remove, this);
+
         auto on_item_removed = [this](SessionItem* item, TagRow tagrow) {
             onItemRemoved(item, tagrow);
         };
@@ -110,7 +283,7 @@ void AbstractViewModelController::setSessionModel(SessionModel* model)
 
         auto on_model_destroyed = [this](SessionModel*) {
             p_impl->m_session_model = nullptr;
-            p_impl->m_view_model->clear();
+            p_impl->reset_view_model();
         };
         sessionModel()->mapper()->setOnModelDestroyed(on_model_destroyed, this);
 
@@ -127,7 +300,8 @@ void AbstractViewModelController::setSessionModel(SessionModel* model)
 void AbstractViewModelController::setChildrenStrategy(
     std::unique_ptr<ChildrenStrategyInterface> children_strategy)
 {
-    p_impl->m_children_strategy = std::move(children_strategy);
+    p_impl->m_children_strategy =
+        std::make_unique<CachedChildrenStrategy>(std::move(children_strategy));
 }
 
 void AbstractViewModelController::setRowStrategy(std::unique_ptr<RowStrategyInterface> row_strategy)
@@ -140,6 +314,196 @@ void AbstractViewModelController::reset_view_model()
     p_impl->reset_view_model();
 }
 
+//! Starts construction of rows of the root item's children in portions.
+
+void AbstractViewModelController::start_construction()
+{
+    if (!p_impl->m_construction_timer) {
+        p_impl->m_construction_timer = std::make_unique<QTimer>();
+        p_impl->m_construction_timer->setSingleShot(true);
+        QObject::connect(p_impl->m_construction_timer.get(), &QTimer::timeout,
+                         [this]() { construct_next_rows(); });
+    }
+
+    p_impl->m_constructed_rows = 0;
+    p_impl->m_is_constructing = true;
+    p_impl->m_construction_timer->start(0);
+}
+
+//! Constructs the next portion of rows of the root item's children and reports the progress.
+
+void AbstractViewModelController::construct_next_rows()
+{
+    const auto& children = p_impl->item_children(rootSessionItem());
+    auto root_view = p_impl->m_view_model->rootViewItem();
+    const int total = static_cast<int>(children.size());
+    const int last = std::min(total, p_impl->m_constructed_rows + p_impl->m_chunk_size);
+
+    for (int index = p_impl->m_constructed_rows; index < last; ++index) {
+        auto child = children[static_cast<size_t>(index)];
+        auto row = p_impl->constructRow(child);
+        if (!row.empty()) {
+            root_view->appendRow(row);
+            if (p_impl->m_lazy_mode)
+                p_impl->mark_unfetched(child);
+            else
+                iterate(child, row.at(0));
+        }
+    }
+
+    p_impl->m_constructed_rows = last;
+    p_impl->m_is_constructing = p_impl->m_constructed_rows < total;
+    if (p_impl->m_is_constructing)
+        p_impl->m_construction_timer->start(0);
+
+    p_impl->m_view_model->constructionProgress(p_impl->m_constructed_rows, total);
+}
+
+//! Recalculates the filter and the sort key of the item, and moves its row to the new position
+//! among rows of its siblings. The row is removed, if the item is filtered out now, and
+//! constructed, if the item was filtered out before.
+
+void AbstractViewModelController::update_row_position(SessionItem* child)
+{
+    auto parent = child->parent();
+    if (!parent || !p_impl->m_children_strategy->updateKey(child))
+        return;
+
+    if (p_impl->is_unfetched(parent)
+        || (p_impl->m_is_constructing && parent == rootSessionItem())) {
+        generate_children_views(parent);
+        return;
+    }
+
+    // the position is found in children reported before the change
+    auto view = p_impl->mappedView(parent, p_impl->item_children(parent), nullptr);
+    int old_row = p_impl->child_row(parent, child);
+    p_impl->m_children_strategy->invalidate(parent);
+    if (!view) {
+        generate_children_views(parent);
+        return;
+    }
+
+    int new_row = p_impl->child_row(parent, child);
+    if (old_row == new_row)
+        return;
+
+    p_impl->flush_data_changes();
+    if (old_row >= 0 && new_row >= 0) {
+        view->insertRow(new_row, view->takeRow(old_row));
+    } else if (old_row >= 0) {
+        view->removeRow(old_row);
+    } else {
+        auto items = p_impl->constructRow(child);
+        if (!items.empty()) {
+            view->insertRow(new_row, items);
+            if (p_impl->m_lazy_mode)
+                p_impl->mark_unfetched(child);
+            else
+                iterate(child, items.at(0));
+        }
+    }
+}
+
+//! Sets lazy mode, where rows of children are constructed on fetchMore request only.
+//! The view model is regenerated, if it was initialized already.
+
+void AbstractViewModelController::setLazyMode(bool value)
+{
+    if (p_impl->m_lazy_mode == value)
+        return;
+
+    p_impl->m_lazy_mode = value;
+    if (sessionModel())
+        init_view_model();
+}
+
+bool AbstractViewModelController::isLazyMode() const
+{
+    return p_impl->m_lazy_mode;
+}
+
+//! Sets the interval in msec for reporting data changes. Changes collected during the interval
+//! are reported together, grouped into rectangles of changed cells. Zero interval means reporting
+//! on the next event loop iteration, 16 msec limits the updates to 60 Hz. Negative interval (the
+//! default) means reporting every change immediately.
+
+void AbstractViewModelController::setUpdateInterval(int msec)
+{
+    p_impl->m_update_interval = msec;
+    if (msec < 0)
+        p_impl->flush_data_changes();
+}
+
+int AbstractViewModelController::updateInterval() const
+{
+    return p_impl->m_update_interval;
+}
+
+//! Reports data changes collected so far, without waiting for the end of the update interval.
+
+void AbstractViewModelController::flushDataChanges()
+{
+    p_impl->flush_data_changes();
+}
+
+//! Sets the number of top level rows to construct per event loop iteration. Zero (the default)
+//! means that the whole view model is constructed at once. The view model is regenerated, if it
+//! was initialized already.
+
+void AbstractViewModelController::setConstructionChunkSize(int rows)
+{
+    if (p_impl->m_chunk_size == rows)
+        return;
+
+    p_impl->m_chunk_size = rows;
+    if (sessionModel())
+        init_view_model();
+}
+
+int AbstractViewModelController::constructionChunkSize() const
+{
+    return p_impl->m_chunk_size;
+}
+
+//! Returns true if rows of the root item's children are still being constructed.
+
+bool AbstractViewModelController::isConstructing() const
+{
+    return p_impl->m_is_constructing;
+}
+
+//! Sets the filter to hide rows of items, for which the function returns false. The filter is
+//! applied to children reported by the children strategy on all levels. The view model is
+//! regenerated, if it was initialized already.
+
+void AbstractViewModelController::setFilter(std::function<bool(const SessionItem*)> filter)
+{
+    if (!p_impl->m_children_strategy)
+        throw std::runtime_error("AbstractViewModelController::setFilter() -> Error. "
+                                 "Children strategy is not defined");
+
+    p_impl->m_children_strategy->setFilter(std::move(filter));
+    if (sessionModel())
+        init_view_model();
+}
+
+//! Sets the function to calculate sort keys of items. Rows of children reported by the children
+//! strategy are sorted by keys on all levels. Numeric keys are compared by value, all others as
+//! strings. The view model is regenerated, if it was initialized already.
+
+void AbstractViewModelController::setSortKey(std::function<QVariant(const SessionItem*)> sort_key,
+                                             Qt::SortOrder order)
+{
+    if (!p_impl->m_children_strategy)
+        throw std::runtime_error("AbstractViewModelController::setSortKey() -> Error. "
+                                 "Children strategy is not defined");
+
+    p_impl->m_children_strategy->setSortKey(std::move(sort_key), order);
+    if (sessionModel())
+        init_view_model();
+}
+
 void AbstractViewModelController::iterate(const SessionItem* item, QStandardItem* parent)
 {
     QStandardItem* origParent(parent);
@@ -149,18 +513,74 @@ void AbstractViewModelController::iterate(const SessionItem* item, QStandardItem
         if (!row.empty()) {
             parent->appendRow(row);
             parent = row.at(0); // labelItem
-            iterate(child, parent);
+            if (p_impl->m_lazy_mode)
+                p_impl->mark_unfetched(child);
+            else
+                iterate(child, parent);
         }
 
         parent = origParent;
     }
 }
 
+//! Returns true if rows of item's children were not constructed yet in lazy mode.
+
+bool AbstractViewModelController::canFetchMore(const SessionItem* item) const
+{
+    return p_impl->is_unfetched(item);
+}
+
+//! Constructs rows of item's children, if they were not constructed yet in lazy mode.
+//! If the content of the item isn't loaded yet, it is loaded first. The item is replaced in the
+//! model with the loaded one, whose row is then populated.
+
+void AbstractViewModelController::fetchMore(SessionItem* item)
+{
+    if (!p_impl->is_unfetched(item))
+        return;
+
+    if (sessionModel()->canFetchItem(item)) {
+        auto parent = item->parent();
+        auto tagrow = parent->tagRowOfItem(item);
+        sessionModel()->fetchItem(item);
+        item = parent->getItem(tagrow.tag, tagrow.row);
+        if (!item || !p_impl->is_unfetched(item))
+            return;
+    }
+
+    p_impl->m_unfetched.erase(item);
+    auto views = p_impl->findStandardViews(item);
+    if (!views.empty())
+        iterate(item, views.front());
+}
+
+//! Removes rows of item's children in lazy mode. They will be constructed again on next
+//! fetchMore request.
+
+void AbstractViewModelController::releaseChildren(SessionItem* item)
+{
+    if (!p_impl->m_lazy_mode || item == rootSessionItem() || p_impl->is_unfetched(item))
+        return;
+
+    auto views = p_impl->findStandardViews(item);
+    if (views.empty())
+        return;
+
+    p_impl->flush_data_changes();
+    for (auto view : views)
+        view->removeRows(0, view->rowCount());
+    p_impl->mark_unfetched(item);
+}
+
 void AbstractViewModelController::init_view_model()
 {
     check_initialization();
     reset_view_model();
-    iterate(rootSessionItem(), p_impl->m_view_model->rootViewItem());
+    p_impl->m_unfetched.clear();
+    if (p_impl->m_chunk_size > 0)
+        start_construction();
+    else
+        iterate(rootSessionItem(), p_impl->m_view_model->rootViewItem());
     p_impl->update_labels();
 }
 
@@ -212,37 +632,141 @@ void AbstractViewModelController::check_initialization()
 
 void AbstractViewModelController::generate_children_views(SessionItem* parent)
 {
+    p_impl->m_children_strategy->invalidate(parent);
+    p_impl->m_children_strategy->forget(parent);
+
+    if (p_impl->is_unfetched(parent)) {
+        p_impl->mark_unfetched(parent);
+        return;
+    }
+
+    p_impl->flush_data_changes();
     auto views = p_impl->findStandardViews(parent);
     for (auto view : views)
         view->removeRows(0, view->rowCount());
 
-    if (views.size())
+    if (p_impl->m_is_constructing && parent == rootSessionItem())
+        start_construction();
+    else if (views.size())
         iterate(parent, views.at(0));
 }
 
-//! Generates necessary notifications on SessionItem's data change.
+//! Generates necessary notifications on SessionItem's data change. If update interval is set,
+//! the change is collected to be reported later together with other changes.
 
 void AbstractViewModelController::onDataChange(SessionItem* item, int role)
 {
     for (auto view : p_impl->m_view_model->findViews(item)) {
         // inform corresponding LabelView and DataView
-        if (isValidItemRole(view, role)) {
+        if (!isValidItemRole(view, role))
+            continue;
+
+        if (p_impl->m_update_interval >= 0) {
+            p_impl->add_data_change(view, Utils::item_role_to_qt(role));
+        } else {
             auto index = p_impl->m_view_model->indexFromItem(view);
             p_impl->m_view_model->dataChanged(index, index, Utils::item_role_to_qt(role));
         }
     }
+
+    // filter and sort keys normally depend on item's own data, or on data of its properties
+    if (p_impl->m_children_strategy->isSortedOrFiltered()) {
+        update_row_position(item);
+        if (auto parent = item->parent(); parent)
+            update_row_position(parent);
+    }
 }
 
-//! Rebuild view model branch on session model change.
+//! Inserts the row of the new item into the view of the parent. The branch of the parent is
+//! rebuilt, if the row can't be mapped through the children strategy.
 
-void AbstractViewModelController::onItemInserted(SessionItem* parent, TagRow)
+void AbstractViewModelController::onItemInserted(SessionItem* parent, TagRow tagrow)
 {
-    generate_children_views(parent);
+    auto child = parent->getItem(tagrow.tag, tagrow.row);
+    p_impl->m_children_strategy->invalidate(parent);
+    p_impl->m_children_strategy->forget(child);
+
+    if (p_impl->is_unfetched(parent))
+        return;
+
+    QStandardItem* view{nullptr};
+    int row = p_impl->child_row(parent, child);
+    if (p_impl->m_is_constructing && parent == rootSessionItem()) {
+        // rows after constructed ones will be constructed later
+        if (row < 0 || row >= p_impl->m_constructed_rows)
+            return;
+        ++p_impl->m_constructed_rows;
+        view = p_impl->m_view_model->rootViewItem();
+    } else {
+        view = p_impl->mappedView(parent, p_impl->item_children(parent), child);
+        if (!view) {
+            generate_children_views(parent);
+            return;
+        }
+        if (row < 0)
+            return;
+    }
+
+    auto items = p_impl->constructRow(child);
+    if (!items.empty()) {
+        view->insertRow(row, items);
+        if (p_impl->m_lazy_mode)
+            p_impl->mark_unfetched(child);
+        else
+            iterate(child, items.at(0));
+    }
+}
+
+//! Removes the row of the item which is about to be removed from the view of the parent.
+//! If the row can't be mapped through the children strategy, the branch of the parent will be
+//! rebuilt after the removal.
+
+void AbstractViewModelController::onItemAboutToBeRemoved(SessionItem* parent, TagRow tagrow)
+{
+    auto child = parent->getItem(tagrow.tag, tagrow.row);
+    Utils::iterate_if(child, [this](const SessionItem* item) {
+        p_impl->m_unfetched.erase(item);
+        return true;
+    });
+    p_impl->m_children_strategy->forget(child);
+    if (p_impl->is_unfetched(parent))
+        return;
+
+    if (p_impl->m_is_constructing && parent == rootSessionItem()) {
+        int row = p_impl->child_row(parent, child);
+        if (row >= 0 && row < p_impl->m_constructed_rows) {
+            p_impl->flush_data_changes();
+            p_impl->m_view_model->rootViewItem()->removeRow(row);
+            --p_impl->m_constructed_rows;
+        }
+        return;
+    }
+
+    auto view = p_impl->mappedView(parent, p_impl->item_children(parent), nullptr);
+    if (!view) {
+        if (!p_impl->findStandardViews(parent).empty())
+            p_impl->m_rebuild_parent = parent;
+        return;
+    }
+
+    int row = p_impl->child_row(parent, child);
+    if (row >= 0) {
+        p_impl->flush_data_changes();
+        view->removeRow(row);
+    }
 }
 
-//! Rebuild view model branch on session model change.
+//! Rebuilds view model branch, if rows were not removed before.
 
 void AbstractViewModelController::onItemRemoved(SessionItem* parent, TagRow)
 {
+    p_impl->m_children_strategy->invalidate(parent);
+    if (p_impl->is_unfetched(parent))
+        p_impl->mark_unfetched(parent);
+
+    if (p_impl->m_rebuild_parent != parent)
+        return;
+
+    p_impl->m_rebuild_parent = nullptr;
     generate_children_views(parent);
 }
@@ -10,6 +10,8 @@
 #ifndef MVVM_VIEWMODEL_ABSTRACTVIEWMODELCONTROLLER_H
 #define MVVM_VIEWMODEL_ABSTRACTVIEWMODELCONTROLLER_H
 
+#include <QVariant>
+#include <functional>
 #include <memory>
 #include <mvvm/core/export.h>
 #include <mvvm/model/tagrow.h>
@@ -29,6 +31,29 @@ class SessionModel;
 /*!
 @class AbstractViewModelController
 @brief Propagates changes from SessionModel to its AbstractViewModel.
+
+In lazy mode, rows of children are constructed only on explicit fetchMore request, which
+normally comes from Qt view on expansion of the parent. Fetched children can be released,
+e.g. when the parent gets collapsed, and will be constructed again on the next request.
+Items, which content is loaded on demand (see SessionModel::canFetchItem), are loaded on the
+first fetchMore request.
+
+By default, every data change of SessionItem is reported immediately with dataChanged signal of
+the view model. With update interval set, changes are collected and reported periodically, with
+a single signal for every rectangle of changed cells. This reduces the repaint work of Qt views
+on bulk updates and on frequent updates of live models.
+
+Children reported by the children strategy are cached per SessionItem and invalidated on
+insert/remove of items, and on regeneration of the branch.
+
+With construction chunk size set, rows of children of the root item are constructed in portions
+on consecutive iterations of the event loop. Items inserted into the root during the
+construction get their rows either immediately, if they are placed among already constructed
+rows, or together with the rest of rows.
+
+Rows can be filtered and sorted by SessionItem's data, without proxy models on top. Filter and
+sort keys are cached per item. On data change, keys of the item and its parent are recalculated
+and, if they have changed, the corresponding row is moved to its new position, or hidden.
 */
 
 class CORE_EXPORT AbstractViewModelController
@@ -46,8 +71,35 @@ public:
 
     void setRowStrategy(std::unique_ptr<RowStrategyInterface> row_strategy);
 
+    void setLazyMode(bool value);
+
+    bool isLazyMode() const;
+
+    void setUpdateInterval(int msec);
+
+    int updateInterval() const;
+
+    void flushDataChanges();
+
+    void setConstructionChunkSize(int rows);
+
+    int constructionChunkSize() const;
+
+    bool isConstructing() const;
+
+    void setFilter(std::function<bool(const SessionItem*)> filter);
+
+    void setSortKey(std::function<QVariant(const SessionItem*)> sort_key,
+                    Qt::SortOrder order = Qt::AscendingOrder);
+
     virtual void iterate(const SessionItem* item, QStandardItem* parent);
 
+    bool canFetchMore(const SessionItem* item) const;
+
+    void fetchMore(SessionItem* item);
+
+    void releaseChildren(SessionItem* item);
+
     void init_view_model();
 
     void setRootSessionItem(SessionItem* item);
@@ -63,10 +115,14 @@ protected:
     void generate_children_views(SessionItem* parent);
     virtual void onDataChange(SessionItem* item, int role);
     virtual void onItemInserted(SessionItem* parent, TagRow tagrow);
+    virtual void onItemAboutToBeRemoved(SessionItem* parent, TagRow tagrow);
     virtual void onItemRemoved(SessionItem* parent, TagRow tagrow);
 
 private:
     void reset_view_model();
+    void start_construction();
+    void construct_next_rows();
+    void update_row_position(SessionItem* child);
     struct AbstractViewModelControllerImpl;
     std::unique_ptr<AbstractViewModelControllerImpl> p_impl;
 };
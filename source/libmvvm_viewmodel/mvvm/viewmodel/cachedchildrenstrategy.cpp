@@ -0,0 +1,234 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <algorithm>
+#include <cmath>
+#include <mvvm/model/itemutils.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/viewmodel/cachedchildrenstrategy.h>
+
+using namespace ModelView;
+
+namespace
+{
+
+bool isNumber(const QVariant& variant)
+{
+    switch (variant.type()) {
+    case QVariant::Bool:
+    case QVariant::Int:
+    case QVariant::UInt:
+    case QVariant::LongLong:
+    case QVariant::ULongLong:
+    case QVariant::Double:
+        return true;
+    default:
+        return false;
+    }
+}
+
+//! Compares valid sort keys: all numbers go before all strings, numbers are compared by value with
+//! NaN after other numbers, strings are compared as strings. Mixed keys are ordered consistently.
+bool isLess(const QVariant& lhs, const QVariant& rhs)
+{
+    const bool lhs_is_number = isNumber(lhs);
+    if (lhs_is_number != isNumber(rhs))
+        return lhs_is_number;
+
+    if (!lhs_is_number)
+        return lhs.toString() < rhs.toString();
+
+    const double lhs_value = lhs.toDouble();
+    const double rhs_value = rhs.toDouble();
+    if (std::isnan(lhs_value))
+        return false;
+    return std::isnan(rhs_value) || lhs_value < rhs_value;
+}
+
+} // namespace
+
+CachedChildrenStrategy::CachedChildrenStrategy(std::unique_ptr<ChildrenStrategyInterface> strategy)
+    : m_strategy(std::move(strategy))
+{
+}
+
+CachedChildrenStrategy::~CachedChildrenStrategy() = default;
+
+std::vector<SessionItem*> CachedChildrenStrategy::children(const SessionItem* item) const
+{
+    return cachedChildren(item);
+}
+
+//! Returns position of the child among cached children of given item, or -1 if it is absent.
+//! Rows of all children are mapped on the first call, so the lookup doesn't depend on the number
+//! of children.
+
+int CachedChildrenStrategy::childRow(const SessionItem* item, const SessionItem* child) const
+{
+    auto entry = cached_entry(item);
+    if (!entry)
+        return -1;
+
+    if (entry->rows.empty()) {
+        entry->rows.reserve(entry->items.size());
+        for (size_t row = 0; row < entry->items.size(); ++row)
+            entry->rows.emplace(entry->items[row], static_cast<int>(row));
+    }
+
+    auto it = entry->rows.find(child);
+    return it == entry->rows.end() ? -1 : it->second;
+}
+
+//! Returns children of given item, asking the underlying strategy only if they are not cached.
+
+const std::vector<SessionItem*>&
+CachedChildrenStrategy::cachedChildren(const SessionItem* item) const
+{
+    static const std::vector<SessionItem*> empty;
+    auto entry = cached_entry(item);
+    return entry ? entry->items : empty;
+}
+
+//! Removes cached children of the item and all its ancestors. To be called on the change of the
+//! item's layout.
+
+void CachedChildrenStrategy::invalidate(const SessionItem* item)
+{
+    for (auto parent = item; parent; parent = parent->parent())
+        m_cache.erase(parent);
+}
+
+//! Removes cached children of the item and all its descendants. To be called before the removal
+//! of the item, or after the insertion of the new item.
+
+void CachedChildrenStrategy::forget(const SessionItem* item)
+{
+    Utils::iterate_if(item, [this](const SessionItem* x) {
+        m_cache.erase(x);
+        m_keys.erase(x);
+        return true;
+    });
+}
+
+void CachedChildrenStrategy::clear()
+{
+    m_cache.clear();
+    m_keys.clear();
+}
+
+//! Sets the filter to hide children, for which the function returns false.
+
+void CachedChildrenStrategy::setFilter(std::function<bool(const SessionItem*)> filter)
+{
+    m_filter = std::move(filter);
+    clear();
+}
+
+//! Sets the function to calculate sort keys of children. Numeric keys are compared by value,
+//! all others as strings, numeric keys go before string keys. Children with invalid keys go last,
+//! in their original order.
+
+void CachedChildrenStrategy::setSortKey(std::function<QVariant(const SessionItem*)> sort_key,
+                                        Qt::SortOrder order)
+{
+    m_sort_key = std::move(sort_key);
+    m_order = order;
+    clear();
+}
+
+bool CachedChildrenStrategy::isSortedOrFiltered() const
+{
+    return m_filter || m_sort_key;
+}
+
+//! Recalculates the filter and the sort key of the item. Returns true if any of them has
+//! changed, so the item might have a new position among its siblings. The parent of the item
+//! should be invalidated then.
+
+bool CachedChildrenStrategy::updateKey(const SessionItem* item)
+{
+    auto it = m_keys.find(item);
+    if (it == m_keys.end())
+        return false;
+
+    auto key = calculate_key(item);
+    if (key.is_accepted == it->second.is_accepted && key.sort_key == it->second.sort_key)
+        return false;
+
+    it->second = std::move(key);
+    return true;
+}
+
+CachedChildrenStrategy::ItemKey CachedChildrenStrategy::calculate_key(const SessionItem* item) const
+{
+    ItemKey result;
+    result.is_accepted = m_filter ? m_filter(item) : true;
+    if (m_sort_key && result.is_accepted) {
+        result.sort_key = m_sort_key(item);
+        // strings are converted once, and not on every comparison
+        if (result.sort_key.isValid() && !isNumber(result.sort_key))
+            result.sort_key = result.sort_key.toString();
+    }
+    return result;
+}
+
+const CachedChildrenStrategy::ItemKey&
+CachedChildrenStrategy::item_key(const SessionItem* item) const
+{
+    auto it = m_keys.find(item);
+    if (it == m_keys.end())
+        it = m_keys.emplace(item, calculate_key(item)).first;
+    return it->second;
+}
+
+//! Returns cached children of given item, asking the underlying strategy only if they are not
+//! cached. Returns nullptr for the item without children.
+
+CachedChildrenStrategy::Children*
+CachedChildrenStrategy::cached_entry(const SessionItem* item) const
+{
+    if (auto it = m_cache.find(item); it != m_cache.end())
+        return &it->second;
+
+    auto result = m_strategy->children(item);
+    if (isSortedOrFiltered())
+        filter_and_sort(result);
+    if (result.empty())
+        return nullptr;
+
+    return &m_cache.emplace(item, Children{std::move(result), {}}).first->second;
+}
+
+//! Removes children which are not accepted by the filter, sorts the rest by their keys.
+
+void CachedChildrenStrategy::filter_and_sort(std::vector<SessionItem*>& items) const
+{
+    std::vector<std::pair<const QVariant*, SessionItem*>> keys;
+    keys.reserve(items.size());
+    for (auto child : items) {
+        const auto& key = item_key(child);
+        if (key.is_accepted)
+            keys.emplace_back(&key.sort_key, child);
+    }
+
+    if (m_sort_key) {
+        auto ascending = m_order == Qt::AscendingOrder;
+        std::stable_sort(keys.begin(), keys.end(), [ascending](const auto& lhs, const auto& rhs) {
+            const auto& lhs_key = *lhs.first;
+            const auto& rhs_key = *rhs.first;
+            if (!lhs_key.isValid() || !rhs_key.isValid())
+                return lhs_key.isValid() && !rhs_key.isValid();
+            return ascending ? isLess(lhs_key, rhs_key) : isLess(rhs_key, lhs_key);
+        });
+    }
+
+    items.clear();
+    for (const auto& key : keys)
+        items.push_back(key.second);
+}
@@ -0,0 +1,90 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_VIEWMODEL_CACHEDCHILDRENSTRATEGY_H
+#define MVVM_VIEWMODEL_CACHEDCHILDRENSTRATEGY_H
+
+#include <QVariant>
+#include <functional>
+#include <memory>
+#include <mvvm/viewmodel/childrenstrategyinterface.h>
+#include <unordered_map>
+
+namespace ModelView
+{
+
+/*!
+@class CachedChildrenStrategy
+@brief Strategy which remembers children reported by another strategy for every SessionItem.
+
+Cached children of the item are valid as long as the layout of the model doesn't change. The
+owner is responsible for invalidation of the cache on insert/remove of items: reported children
+of the item may depend on the layout of its descendants, so the item is invalidated together
+with its ancestors. Items without children are not cached. Rows of children are looked up in
+the map built alongside the cached children.
+
+Reported children can be filtered and sorted. The filter and the sort key are calculated once
+per item and cached. After the change of the item's data, updateKey() recalculates them and
+tells if the position of the item among its siblings might have changed.
+*/
+
+class CORE_EXPORT CachedChildrenStrategy : public ChildrenStrategyInterface
+{
+public:
+    explicit CachedChildrenStrategy(std::unique_ptr<ChildrenStrategyInterface> strategy);
+    ~CachedChildrenStrategy() override;
+
+    std::vector<SessionItem*> children(const SessionItem* item) const override;
+
+    int childRow(const SessionItem* item, const SessionItem* child) const override;
+
+    const std::vector<SessionItem*>& cachedChildren(const SessionItem* item) const;
+
+    void invalidate(const SessionItem* item);
+
+    void forget(const SessionItem* item);
+
+    void clear();
+
+    void setFilter(std::function<bool(const SessionItem*)> filter);
+
+    void setSortKey(std::function<QVariant(const SessionItem*)> sort_key,
+                    Qt::SortOrder order = Qt::AscendingOrder);
+
+    bool isSortedOrFiltered() const;
+
+    bool updateKey(const SessionItem* item);
+
+private:
+    struct ItemKey {
+        QVariant sort_key;
+        bool is_accepted{true};
+    };
+
+    struct Children {
+        std::vector<SessionItem*> items;
+        std::unordered_map<const SessionItem*, int> rows; //!< row of every child, built on demand
+    };
+
+    ItemKey calculate_key(const SessionItem* item) const;
+    const ItemKey& item_key(const SessionItem* item) const;
+    Children* cached_entry(const SessionItem* item) const;
+    void filter_and_sort(std::vector<SessionItem*>& items) const;
+
+    std::unique_ptr<ChildrenStrategyInterface> m_strategy;
+    mutable std::unordered_map<const SessionItem*, Children> m_cache;
+    std::function<bool(const SessionItem*)> m_filter;
+    std::function<QVariant(const SessionItem*)> m_sort_key;
+    Qt::SortOrder m_order{Qt::AscendingOrder};
+    mutable std::unordered_map<const SessionItem*, ItemKey> m_keys;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_VIEWMODEL_CACHEDCHILDRENSTRATEGY_H
@@ -11,7 +11,9 @@
 #define MVVM_VIEWMODEL_CHILDRENSTRATEGYINTERFACE_H
 
 #include <QList>
+#include <algorithm>
 #include <mvvm/core/export.h>
+#include <vector>
 
 class QStandardItem;
 
@@ -33,6 +35,15 @@ public:
 
     //! Returns vector of children of given item.
     virtual std::vector<SessionItem*> children(const SessionItem* item) const = 0;
+
+    //! Returns position of the child in the vector of children of given item, or -1 if it is
+    //! absent.
+    virtual int childRow(const SessionItem* item, const SessionItem* child) const
+    {
+        auto items = children(item);
+        auto it = std::find(items.begin(), items.end(), child);
+        return it == items.end() ? -1 : static_cast<int>(std::distance(items.begin(), it));
+    }
 };
 
 } // namespace ModelView
@@ -9,6 +9,7 @@
 
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/viewmodel/labeldatarowstrategy.h>
+#include <mvvm/viewmodel/refviewitems.h>
 #include <mvvm/viewmodel/viewitems.h>
 
 using namespace ModelView;
@@ -32,6 +33,21 @@ QList<QStandardItem*> LabelDataRowStrategy::constructRow(SessionItem* item)
     return result;
 }
 
+std::vector<std::unique_ptr<RefViewItem>> LabelDataRowStrategy::constructRefRow(SessionItem* item)
+{
+    std::vector<std::unique_ptr<RefViewItem>> result;
+
+    if (!item)
+        return result;
+
+    result.emplace_back(std::make_unique<RefViewLabelItem>(item));
+    if (item->data().isValid())
+        result.emplace_back(std::make_unique<RefViewDataItem>(item));
+    else
+        result.emplace_back(std::make_unique<RefViewItem>());
+    return result;
+}
+
 QStringList LabelDataRowStrategy::horizontalHeaderLabels() const
 {
     return QStringList() << "Name"
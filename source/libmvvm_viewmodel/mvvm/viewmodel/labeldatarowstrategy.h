@@ -10,6 +10,7 @@
 #ifndef MVVM_VIEWMODEL_LABELDATAROWSTRATEGY_H
 #define MVVM_VIEWMODEL_LABELDATAROWSTRATEGY_H
 
+#include <mvvm/viewmodel/refrowstrategyinterface.h>
 #include <mvvm/viewmodel/rowstrategyinterface.h>
 
 class QStandardItem;
@@ -19,14 +20,15 @@ namespace ModelView
 
 class SessionItem;
 
-//! Constructs row of QStandardItem's for given SessionItem.
+//! Constructs row of QStandardItem's, or RefViewItem's, for given SessionItem.
 //! Row consists of two columns, ViewLabelItem for SessionItem's display role and
 //! ViewDataItem for Session's item data role.
 
-class CORE_EXPORT LabelDataRowStrategy : public RowStrategyInterface
+class CORE_EXPORT LabelDataRowStrategy : public RowStrategyInterface, public RefRowStrategyInterface
 {
 public:
     QList<QStandardItem*> constructRow(SessionItem* item);
+    std::vector<std::unique_ptr<RefViewItem>> constructRefRow(SessionItem* item);
     QStringList horizontalHeaderLabels() const;
 };
 
@@ -10,6 +10,7 @@
 #ifndef MVVM_VIEWMODEL_PROPERTIESROWSTRATEGY_H
 #define MVVM_VIEWMODEL_PROPERTIESROWSTRATEGY_H
 
+#include <mvvm/viewmodel/refrowstrategyinterface.h>
 #include <mvvm/viewmodel/rowstrategyinterface.h>
 
 class QStandardItem;
@@ -19,15 +20,17 @@ namespace ModelView
 
 class SessionItem;
 
-//! Constructs row of QStandardItem's for given SessionItem.
+//! Constructs row of QStandardItem's, or RefViewItem's, for given SessionItem.
 //! Row consists of columns with all PropertyItem's of given SessionItem.
 
-class CORE_EXPORT PropertiesRowStrategy : public RowStrategyInterface
+class CORE_EXPORT PropertiesRowStrategy : public RowStrategyInterface,
+                                          public RefRowStrategyInterface
 {
 public:
     PropertiesRowStrategy(const std::vector<std::string>& labels = {});
 
     QList<QStandardItem*> constructRow(SessionItem* item);
+    std::vector<std::unique_ptr<RefViewItem>> constructRefRow(SessionItem* item);
     QStringList horizontalHeaderLabels() const;
 
 private:
@@ -0,0 +1,44 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_VIEWMODEL_REFROWSTRATEGYINTERFACE_H
+#define MVVM_VIEWMODEL_REFROWSTRATEGYINTERFACE_H
+
+#include <QStringList>
+#include <memory>
+#include <mvvm/core/export.h>
+#include <vector>
+
+namespace ModelView
+{
+
+class SessionItem;
+class RefViewItem;
+
+/*!
+@class RefRowStrategyInterface
+@brief Base class to construct row of RefViewItems from given SessionItem.
+
+Used in context of RefViewModel while exposing SessionModel to Qt.
+*/
+
+class CORE_EXPORT RefRowStrategyInterface
+{
+public:
+    virtual ~RefRowStrategyInterface() = default;
+
+    //! Construct row of RefViewItems from given SessionItem.
+    virtual std::vector<std::unique_ptr<RefViewItem>> constructRefRow(SessionItem* item) = 0;
+
+    virtual QStringList horizontalHeaderLabels() const = 0;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_VIEWMODEL_REFROWSTRATEGYINTERFACE_H
@@ -8,8 +8,11 @@
 // ************************************************************************** //
 
 #include <algorithm>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/sessionitem.h>
 #include <mvvm/utils/containerutils.h>
 #include <mvvm/viewmodel/refviewitem.h>
+#include <mvvm/viewmodel/viewmodelutils.h>
 #include <vector>
 
 using namespace ModelView;
@@ -21,6 +24,7 @@ struct RefViewItem::RefViewItemImpl {
     SessionItem* item{nullptr};
     int role{0};
     RefViewItem* parent_view_item{nullptr};
+    mutable int index_hint{0}; //! last known position of the item in the buffer of its parent
     RefViewItemImpl(SessionItem* item, int role) : item(item), role(role) {}
 
     void appendRow(std::vector<std::unique_ptr<RefViewItem>> items)
@@ -73,9 +77,19 @@ struct RefViewItem::RefViewItemImpl {
 
     RefViewItem* parent() { return parent_view_item; }
 
+    //! Returns position of the child in the buffer. Last known position is checked first, so
+    //! sequential requests for the same child don't require search.
+
     int index_of_child(const RefViewItem* child)
     {
-        return Utils::IndexOfItem(children.begin(), children.end(), child);
+        int hint = child->p_impl->index_hint;
+        if (hint >= 0 && hint < static_cast<int>(children.size())
+            && children[static_cast<size_t>(hint)].get() == child)
+            return hint;
+
+        int result = Utils::IndexOfItem(children.begin(), children.end(), child);
+        child->p_impl->index_hint = result;
+        return result;
     }
 };
 
@@ -171,6 +185,40 @@ int RefViewItem::column() const
     return index >= 0 ? index % parent()->p_impl->columns : -1;
 }
 
+//! Returns the data for the given Qt role. Display and edit roles are reporting the data of
+//! SessionItem for the role of this view.
+
+QVariant RefViewItem::data(int qt_role) const
+{
+    if (!p_impl->item)
+        return QVariant();
+
+    if (qt_role == Qt::DisplayRole || qt_role == Qt::EditRole)
+        return Utils::toQtVariant(p_impl->item->data(p_impl->role));
+#if QT_VERSION >= QT_VERSION_CHECK(5, 13, 0)
+    else if (qt_role == Qt::ForegroundRole)
+#else
+    else if (qt_role == Qt::TextColorRole)
+#endif
+        return Utils::TextColorRole(*p_impl->item);
+
+    return QVariant();
+}
+
+//! Sets the data to SessionItem. Returns true if data was changed.
+
+bool RefViewItem::setData(const QVariant& value, int qt_role)
+{
+    if (p_impl->item && qt_role == Qt::EditRole)
+        return p_impl->item->setData(Utils::toCustomVariant(value), p_impl->role);
+    return false;
+}
+
+Qt::ItemFlags RefViewItem::flags() const
+{
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
 void RefViewItem::setParent(RefViewItem* parent)
 {
     p_impl->parent_view_item = parent;
@@ -10,6 +10,7 @@
 #ifndef MVVM_VIEWMODEL_REFVIEWITEM_H
 #define MVVM_VIEWMODEL_REFVIEWITEM_H
 
+#include <QVariant>
 #include <memory>
 #include <mvvm/core/export.h>
 #include <vector>
@@ -20,6 +21,7 @@ namespace ModelView
 class SessionItem;
 
 //! Represents the view of SessionItem's data in single cell of ViewModel.
+//! Without SessionItem it represents an empty read only cell.
 
 class CORE_EXPORT RefViewItem
 {
@@ -51,6 +53,12 @@ public:
 
     int column() const;
 
+    virtual QVariant data(int qt_role) const;
+
+    virtual bool setData(const QVariant& value, int qt_role);
+
+    virtual Qt::ItemFlags flags() const;
+
 protected:
     void setParent(RefViewItem* parent);
 
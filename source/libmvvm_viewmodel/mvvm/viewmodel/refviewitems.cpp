@@ -0,0 +1,58 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/model/mvvm_types.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/viewmodel/refviewitems.h>
+#include <mvvm/viewmodel/viewmodelutils.h>
+
+using namespace ModelView;
+
+RefViewLabelItem::RefViewLabelItem(SessionItem* item) : RefViewItem(item, ItemDataRole::DISPLAY) {}
+
+QVariant RefViewLabelItem::data(int qt_role) const
+{
+    // use item's display role
+    if (item() && (qt_role == Qt::DisplayRole || qt_role == Qt::EditRole))
+        return QString::fromStdString(item()->displayName());
+
+    return RefViewItem::data(qt_role);
+}
+
+//! Label view is always read only.
+
+bool RefViewLabelItem::setData(const QVariant&, int)
+{
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+
+RefViewDataItem::RefViewDataItem(SessionItem* item) : RefViewItem(item, ItemDataRole::DATA) {}
+
+QVariant RefViewDataItem::data(int qt_role) const
+{
+    if (item() && qt_role == Qt::CheckStateRole)
+        return Utils::CheckStateRole(*item());
+
+    else if (item() && qt_role == Qt::DecorationRole)
+        return Utils::DecorationRole(*item());
+
+    return RefViewItem::data(qt_role);
+}
+
+//! SessionItem::isEnabled means simply gray color and read only.
+
+Qt::ItemFlags RefViewDataItem::flags() const
+{
+    auto result = RefViewItem::flags();
+    if (item() && item()->isEditable() && item()->isEnabled())
+        result |= Qt::ItemIsEditable;
+    return result;
+}
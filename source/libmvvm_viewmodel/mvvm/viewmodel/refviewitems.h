@@ -0,0 +1,46 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_VIEWMODEL_REFVIEWITEMS_H
+#define MVVM_VIEWMODEL_REFVIEWITEMS_H
+
+#include <mvvm/viewmodel/refviewitem.h>
+
+namespace ModelView
+{
+
+class SessionItem;
+
+//! Represents display name of SessionItem in any cell of RefViewModel. Always read only.
+
+class CORE_EXPORT RefViewLabelItem : public RefViewItem
+{
+public:
+    explicit RefViewLabelItem(SessionItem* item);
+
+    QVariant data(int qt_role) const override;
+
+    bool setData(const QVariant& value, int qt_role) override;
+};
+
+//! Represents data role of SessionItem in any cell of RefViewModel.
+
+class CORE_EXPORT RefViewDataItem : public RefViewItem
+{
+public:
+    explicit RefViewDataItem(SessionItem* item);
+
+    QVariant data(int qt_role) const override;
+
+    Qt::ItemFlags flags() const override;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_VIEWMODEL_REFVIEWITEMS_H
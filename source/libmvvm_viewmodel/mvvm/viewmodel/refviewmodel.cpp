@@ -9,14 +9,23 @@
 
 #include <mvvm/viewmodel/refviewitem.h>
 #include <mvvm/viewmodel/refviewmodel.h>
+#include <mvvm/viewmodel/refviewmodelcontroller.h>
 
 using namespace ModelView;
 
 struct RefViewModel::RefViewModelImpl {
     RefViewModel* model{nullptr};
     std::unique_ptr<RefViewItem> root;
+    std::unique_ptr<RefViewModelController> controller;
+    QStringList header_labels;
     RefViewModelImpl(RefViewModel* model) : model(model), root(std::make_unique<RefViewItem>()) {}
 
+    void check_controller() const
+    {
+        if (!controller)
+            throw std::runtime_error("Error in RefViewModel: controller is not defined.");
+    }
+
     bool item_belongs_to_model(RefViewItem* item)
     {
         return model->indexFromItem(item).isValid() || item == model->rootItem();
@@ -28,6 +37,13 @@ RefViewModel::RefViewModel(QObject* parent)
 {
 }
 
+RefViewModel::RefViewModel(std::unique_ptr<RefViewModelController> controller, QObject* parent)
+    : RefViewModel(parent)
+{
+    p_impl->controller = std::move(controller);
+    p_impl->controller->setViewModel(this);
+}
+
 RefViewModel::~RefViewModel() = default;
 
 QModelIndex RefViewModel::index(int row, int column, const QModelIndex& parent) const
@@ -66,9 +82,35 @@ int RefViewModel::columnCount(const QModelIndex& parent) const
 
 QVariant RefViewModel::data(const QModelIndex& index, int role) const
 {
-    Q_UNUSED(index)
-    Q_UNUSED(role)
-    return QVariant();
+    auto item = itemFromIndex(index);
+    return item ? item->data(role) : QVariant();
+}
+
+bool RefViewModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    auto item = itemFromIndex(index);
+    return item ? item->setData(value, role) : false;
+}
+
+Qt::ItemFlags RefViewModel::flags(const QModelIndex& index) const
+{
+    auto item = itemFromIndex(index);
+    return item ? item->flags() : QAbstractItemModel::flags(index);
+}
+
+QVariant RefViewModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0
+        && section < p_impl->header_labels.size())
+        return p_impl->header_labels.at(section);
+    return QAbstractItemModel::headerData(section, orientation, role);
+}
+
+void RefViewModel::setHorizontalHeaderLabels(const QStringList& labels)
+{
+    p_impl->header_labels = labels;
+    if (!labels.empty())
+        headerDataChanged(Qt::Horizontal, 0, labels.size() - 1);
 }
 
 //! Returns a pointer to invisible root item.
@@ -116,3 +158,75 @@ void RefViewModel::appendRow(RefViewItem* parent, std::vector<std::unique_ptr<Re
     parent->appendRow(std::move(items));
     endInsertRows();
 }
+
+//! Inserts row of items to given parent at given position.
+
+void RefViewModel::insertRow(RefViewItem* parent, int row,
+                             std::vector<std::unique_ptr<RefViewItem>> items)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error("Error in RefViewModel: attempt to use parent from another model");
+
+    beginInsertRows(indexFromItem(parent), row, row);
+    parent->insertRow(row, std::move(items));
+    endInsertRows();
+}
+
+//! Removes all rows of given parent.
+
+void RefViewModel::clearRows(RefViewItem* parent)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error("Error in RefViewModel: attempt to use parent from another model");
+
+    if (parent->rowCount() == 0)
+        return;
+
+    beginRemoveRows(indexFromItem(parent), 0, parent->rowCount() - 1);
+    parent->clear();
+    endRemoveRows();
+}
+
+//! Removes all rows.
+
+void RefViewModel::clear()
+{
+    beginResetModel();
+    rootItem()->clear();
+    endResetModel();
+}
+
+void RefViewModel::setSessionModel(SessionModel* model)
+{
+    p_impl->check_controller();
+    p_impl->controller->setSessionModel(model);
+}
+
+void RefViewModel::setRootSessionItem(SessionItem* item)
+{
+    p_impl->check_controller();
+    p_impl->controller->setRootSessionItem(item);
+}
+
+//! Returns SessionItem corresponding to given QModelIndex.
+
+SessionItem* RefViewModel::sessionItemFromIndex(const QModelIndex& index) const
+{
+    if (!p_impl->controller || !p_impl->controller->sessionModel())
+        return nullptr;
+
+    return index.isValid() ? itemFromIndex(index)->item() : p_impl->controller->rootSessionItem();
+}
+
+//! Returns list of QModelIndex'es related to given SessionItem.
+
+QModelIndexList RefViewModel::indexOfSessionItem(const SessionItem* item) const
+{
+    QModelIndexList result;
+    if (!p_impl->controller)
+        return result;
+
+    for (auto view : p_impl->controller->findViews(item))
+        result.push_back(indexFromItem(view));
+    return result;
+}
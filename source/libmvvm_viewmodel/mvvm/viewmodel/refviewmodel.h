@@ -11,6 +11,7 @@
 #define MVVM_VIEWMODEL_REFVIEWMODEL_H
 
 #include <QAbstractItemModel>
+#include <QStringList>
 #include <mvvm/core/export.h>
 #include <memory>
 
@@ -18,6 +19,9 @@ namespace ModelView
 {
 
 class RefViewItem;
+class RefViewModelController;
+class SessionItem;
+class SessionModel;
 
 /*!
 @class RefViewModel
@@ -25,13 +29,19 @@ class RefViewItem;
 
 ViewModel is made of ViewItems, where each ViewItem represents some concrete data role
 of SessionItem.
+
+When constructed with RefViewModelController, the view model is synchronized with SessionModel
+in the same way as AbstractViewModel, without per-cell storage of QStandardItem.
 */
 
 class CORE_EXPORT RefViewModel : public QAbstractItemModel
 {
     Q_OBJECT
 public:
+    friend class RefViewModelController;
     explicit RefViewModel(QObject* parent = nullptr);
+    explicit RefViewModel(std::unique_ptr<RefViewModelController> controller,
+                          QObject* parent = nullptr);
     ~RefViewModel() override;
 
     QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
@@ -44,6 +54,15 @@ public:
 
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
 
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    void setHorizontalHeaderLabels(const QStringList& labels);
+
     RefViewItem* rootItem() const;
 
     RefViewItem* itemFromIndex(const QModelIndex& index) const;
@@ -54,6 +73,20 @@ public:
 
     void appendRow(RefViewItem* parent, std::vector<std::unique_ptr<RefViewItem>> items);
 
+    void insertRow(RefViewItem* parent, int row, std::vector<std::unique_ptr<RefViewItem>> items);
+
+    void clearRows(RefViewItem* parent);
+
+    void clear();
+
+    void setSessionModel(SessionModel* model);
+
+    void setRootSessionItem(SessionItem* item);
+
+    SessionItem* sessionItemFromIndex(const QModelIndex& index) const;
+
+    QModelIndexList indexOfSessionItem(const SessionItem* item) const;
+
 private:
     struct RefViewModelImpl;
     std::unique_ptr<RefViewModelImpl> p_impl;
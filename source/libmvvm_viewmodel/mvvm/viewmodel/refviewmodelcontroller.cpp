@@ -0,0 +1,397 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <algorithm>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/signals/modelmapper.h>
+#include <mvvm/viewmodel/cachedchildrenstrategy.h>
+#include <mvvm/viewmodel/refrowstrategyinterface.h>
+#include <mvvm/viewmodel/refviewitem.h>
+#include <mvvm/viewmodel/refviewmodel.h>
+#include <mvvm/viewmodel/refviewmodelcontroller.h>
+#include <mvvm/viewmodel/viewmodelutils.h>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace ModelView;
+
+namespace
+{
+
+//! Returns true if given SessionItem role is valid for view.
+bool isValidItemRole(const RefViewItem* view, int item_role)
+{
+    return view->item_role() == item_role || item_role == ItemDataRole::APPEARANCE;
+}
+
+//! Returns true if the row starting from the given cell is representing given item. The cell is
+//! either the view of the item itself, or the view of one of its children. The item of the cell
+//! is compared by pointer only, since it can be already deleted.
+bool isRowOfItem(const RefViewItem* cell, const SessionItem* item)
+{
+    return cell->item() == item || item->tagRowOfItem(cell->item()).row != -1;
+}
+
+} // namespace
+
+struct RefViewModelController::RefViewModelControllerImpl {
+    RefViewModel* view_model{nullptr};
+    SessionItem* root_item{nullptr};
+    SessionModel* session_model{nullptr};
+    std::unique_ptr<CachedChildrenStrategy> children_strategy;
+    std::unique_ptr<RefRowStrategyInterface> row_strategy;
+    std::unordered_map<const SessionItem*, std::vector<RefViewItem*>> views;
+    SessionItem* rebuild_parent{nullptr}; //!< parent which branch is rebuilt after removal
+
+    RefViewModelControllerImpl(RefViewModel* view_model) : view_model(view_model) {}
+
+    const std::vector<SessionItem*>& item_children(const SessionItem* item) const
+    {
+        return children_strategy->cachedChildren(item);
+    }
+
+    //! Constructs the row for given item, together with rows of all its children.
+
+    std::vector<std::unique_ptr<RefViewItem>> construct_row(SessionItem* item)
+    {
+        auto result = row_strategy->constructRefRow(item);
+        if (!result.empty()) {
+            for (auto& view : result)
+                views[view->item()].push_back(view.get());
+            iterate(item, result.front().get());
+        }
+        return result;
+    }
+
+    //! Constructs rows of children of given item. No notifications are emitted, so the parent
+    //! should be either detached from the model, or the model should be in reset state.
+
+    void iterate(const SessionItem* item, RefViewItem* parent)
+    {
+        for (auto child : item_children(item)) {
+            auto row = construct_row(child);
+            if (!row.empty())
+                parent->appendRow(std::move(row));
+        }
+    }
+
+    //! Removes given rows of the parent, together with all their descendants, from the index of
+    //! views.
+
+    void unregister_rows(const RefViewItem* parent, int first, int last)
+    {
+        for (int row = first; row <= last; ++row) {
+            for (int col = 0; col < parent->columnCount(); ++col) {
+                auto view = parent->child(row, col);
+                unregister_rows(view, 0, view->rowCount() - 1);
+                auto it = views.find(view->item());
+                if (it == views.end())
+                    continue;
+                auto& item_views = it->second;
+                item_views.erase(std::remove(item_views.begin(), item_views.end(), view),
+                                 item_views.end());
+                if (item_views.empty())
+                    views.erase(it);
+            }
+        }
+    }
+
+    void remove_rows(RefViewItem* parent)
+    {
+        if (parent->rowCount() == 0)
+            return;
+        unregister_rows(parent, 0, parent->rowCount() - 1);
+        view_model->clearRows(parent);
+    }
+
+    std::vector<RefViewItem*> find_views(const SessionItem* item) const
+    {
+        if (item == root_session_item())
+            return {view_model->rootItem()};
+
+        auto it = views.find(item);
+        return it == views.end() ? std::vector<RefViewItem*>() : it->second;
+    }
+
+    SessionItem* root_session_item() const
+    {
+        return root_item ? root_item : session_model->rootItem();
+    }
+
+    //! Returns the view of the parent, which rows are representing given children of the parent,
+    //! excluding the one given by the pointer. Returns nullptr if rows can't be mapped to
+    //! children.
+
+    RefViewItem* mapped_view(SessionItem* parent, const std::vector<SessionItem*>& children,
+                             const SessionItem* excluded)
+    {
+        auto parent_views = find_views(parent);
+        if (parent_views.empty())
+            return nullptr;
+
+        for (size_t index = 1; index < parent_views.size(); ++index)
+            if (parent_views[index]->rowCount() > 0)
+                return nullptr;
+
+        auto view = parent_views.front();
+        int row(0);
+        for (auto child : children) {
+            if (child == excluded)
+                continue;
+            if (row >= view->rowCount() || !isRowOfItem(view->child(row, 0), child))
+                return nullptr;
+            ++row;
+        }
+        return row == view->rowCount() ? view : nullptr;
+    }
+
+    //! Returns position of the child among children of the parent, or -1 if it is absent.
+
+    int child_row(const SessionItem* parent, const SessionItem* child) const
+    {
+        return children_strategy->childRow(parent, child);
+    }
+
+    void check_initialization() const
+    {
+        const std::string msg("RefViewModelController::check_initialization() -> Error. ");
+        if (!view_model)
+            throw std::runtime_error(msg + "ViewModel is not defined");
+
+        if (!session_model)
+            throw std::runtime_error(msg + "SessionModel is not defined");
+
+        if (!row_strategy)
+            throw std::runtime_error(msg + "RowStrategy is not defined");
+
+        if (!children_strategy)
+            throw std::runtime_error(msg + "Children is not defined");
+    }
+};
+
+RefViewModelController::RefViewModelController(RefViewModel* view_model)
+    : p_impl(std::make_unique<RefViewModelControllerImpl>(view_model))
+{
+}
+
+RefViewModelController::~RefViewModelController()
+{
+    if (sessionModel())
+        sessionModel()->mapper()->unsubscribe(this);
+}
+
+void RefViewModelController::setViewModel(RefViewModel* view_model)
+{
+    p_impl->view_model = view_model;
+}
+
+void RefViewModelController::setSessionModel(SessionModel* model)
+{
+    if (sessionModel())
+        sessionModel()->mapper()->unsubscribe(this);
+
+    p_impl->session_model = model;
+    p_impl->root_item = nullptr;
+
+    if (sessionModel()) {
+        auto on_data_change = [this](SessionItem* item, int role) { onDataChange(item, role); };
+        sessionModel()->mapper()->setOnDataChange(on_data_change, this);
+
+        auto on_item_inserted = [this](SessionItem* item, TagRow tagrow) {
+            onItemInserted(item, tagrow);
+        };
+        sessionModel()->mapper()->setOnItemInserted(on_item_inserted, this);
+
+        auto on_about_to_remove = [this](SessionItem* item, TagRow tagrow) {
+            onItemAboutToBeRemoved(item, tagrow);
+        };
+        sessionModel()->mapper()->setOnAboutToRemoveItem(on_about_to_remove, this);
+
+        auto on_item_removed = [this](SessionItem* item, TagRow tagrow) {
+            onItemRemoved(item, tagrow);
+        };
+        sessionModel()->mapper()->setOnItemRemoved(on_item_removed, this);
+
+        auto on_model_destroyed = [this](SessionModel*) {
+            p_impl->session_model = nullptr;
+            p_impl->views.clear();
+            p_impl->children_strategy->clear();
+            p_impl->view_model->clear();
+        };
+        sessionModel()->mapper()->setOnModelDestroyed(on_model_destroyed, this);
+
+        // the reset is reported before the new root item is created, so rows are only removed
+        auto on_model_reset = [this](SessionModel*) {
+            p_impl->root_item = nullptr;
+            p_impl->views.clear();
+            p_impl->children_strategy->clear();
+            p_impl->view_model->clear();
+        };
+        sessionModel()->mapper()->setOnModelReset(on_model_reset, this);
+
+        init_view_model();
+    }
+}
+
+void RefViewModelController::setChildrenStrategy(
+    std::unique_ptr<ChildrenStrategyInterface> children_strategy)
+{
+    p_impl->children_strategy =
+        std::make_unique<CachedChildrenStrategy>(std::move(children_strategy));
+}
+
+void RefViewModelController::setRowStrategy(std::unique_ptr<RefRowStrategyInterface> row_strategy)
+{
+    p_impl->row_strategy = std::move(row_strategy);
+}
+
+//! Regenerates the content of the view model. Rows are constructed within the reset of the
+//! model, without notification for every row.
+
+void RefViewModelController::init_view_model()
+{
+    p_impl->check_initialization();
+
+    auto view_model = p_impl->view_model;
+    view_model->beginResetModel();
+    view_model->rootItem()->clear();
+    p_impl->views.clear();
+    p_impl->children_strategy->clear();
+    p_impl->iterate(rootSessionItem(), view_model->rootItem());
+    view_model->endResetModel();
+
+    view_model->setHorizontalHeaderLabels(p_impl->row_strategy->horizontalHeaderLabels());
+}
+
+void RefViewModelController::setRootSessionItem(SessionItem* item)
+{
+    if (item && item->model() != sessionModel())
+        throw std::runtime_error(
+            "RefViewModelController::setRootSessionItem()->Error. Item doesn't belong to a model.");
+
+    p_impl->root_item = item;
+    init_view_model();
+}
+
+//! Returns root item of the model. Can be different from model's root item when the intention is
+//! to show only part of the model.
+
+SessionItem* RefViewModelController::rootSessionItem() const
+{
+    return p_impl->root_session_item();
+}
+
+SessionModel* RefViewModelController::sessionModel()
+{
+    return p_impl->session_model;
+}
+
+const SessionModel* RefViewModelController::sessionModel() const
+{
+    return p_impl->session_model;
+}
+
+//! Returns views of given item, in the order of their construction.
+
+std::vector<RefViewItem*> RefViewModelController::findViews(const SessionItem* item) const
+{
+    return p_impl->find_views(item);
+}
+
+void RefViewModelController::generate_children_views(SessionItem* parent)
+{
+    p_impl->children_strategy->invalidate(parent);
+    p_impl->children_strategy->forget(parent);
+
+    auto views = p_impl->find_views(parent);
+    for (auto view : views)
+        p_impl->remove_rows(view);
+
+    if (views.empty())
+        return;
+
+    for (auto child : p_impl->item_children(parent)) {
+        auto row = p_impl->construct_row(child);
+        if (!row.empty())
+            p_impl->view_model->appendRow(views.front(), std::move(row));
+    }
+}
+
+//! Generates necessary notifications on SessionItem's data change.
+
+void RefViewModelController::onDataChange(SessionItem* item, int role)
+{
+    for (auto view : p_impl->find_views(item)) {
+        // inform corresponding LabelView and DataView
+        if (isValidItemRole(view, role)) {
+            auto index = p_impl->view_model->indexFromItem(view);
+            p_impl->view_model->dataChanged(index, index, Utils::item_role_to_qt(role));
+        }
+    }
+}
+
+//! Inserts the row of the new item into the view of the parent. The branch of the parent is
+//! rebuilt, if the row can't be mapped through the children strategy.
+
+void RefViewModelController::onItemInserted(SessionItem* parent, TagRow tagrow)
+{
+    auto child = parent->getItem(tagrow.tag, tagrow.row);
+    p_impl->children_strategy->invalidate(parent);
+    p_impl->children_strategy->forget(child);
+
+    auto view = p_impl->mapped_view(parent, p_impl->item_children(parent), child);
+    if (!view) {
+        generate_children_views(parent);
+        return;
+    }
+
+    int row = p_impl->child_row(parent, child);
+    if (row < 0)
+        return;
+
+    auto items = p_impl->construct_row(child);
+    if (!items.empty())
+        p_impl->view_model->insertRow(view, row, std::move(items));
+}
+
+//! Removes the row of the item which is about to be removed from the view of the parent.
+//! If the row can't be mapped through the children strategy, the branch of the parent will be
+//! rebuilt after the removal.
+
+void RefViewModelController::onItemAboutToBeRemoved(SessionItem* parent, TagRow tagrow)
+{
+    auto child = parent->getItem(tagrow.tag, tagrow.row);
+    p_impl->children_strategy->forget(child);
+
+    auto view = p_impl->mapped_view(parent, p_impl->item_children(parent), nullptr);
+    if (!view) {
+        if (!p_impl->find_views(parent).empty())
+            p_impl->rebuild_parent = parent;
+        return;
+    }
+
+    int row = p_impl->child_row(parent, child);
+    if (row >= 0) {
+        p_impl->unregister_rows(view, row, row);
+        p_impl->view_model->removeRow(view, row);
+    }
+}
+
+//! Rebuilds view model branch, if rows were not removed before.
+
+void RefViewModelController::onItemRemoved(SessionItem* parent, TagRow)
+{
+    p_impl->children_strategy->invalidate(parent);
+    if (p_impl->rebuild_parent != parent)
+        return;
+
+    p_impl->rebuild_parent = nullptr;
+    generate_children_views(parent);
+}
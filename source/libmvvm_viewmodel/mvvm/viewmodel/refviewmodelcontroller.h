@@ -0,0 +1,77 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_VIEWMODEL_REFVIEWMODELCONTROLLER_H
+#define MVVM_VIEWMODEL_REFVIEWMODELCONTROLLER_H
+
+#include <memory>
+#include <mvvm/core/export.h>
+#include <mvvm/model/tagrow.h>
+#include <vector>
+
+namespace ModelView
+{
+
+class RefViewModel;
+class RefViewItem;
+class SessionItem;
+class SessionModel;
+class ChildrenStrategyInterface;
+class RefRowStrategyInterface;
+
+/*!
+@class RefViewModelController
+@brief Propagates changes from SessionModel to its RefViewModel.
+
+Uses the same children strategies as AbstractViewModelController. Rows are constructed by
+RefRowStrategyInterface. Insert/remove of single SessionItem leads to insert/remove of the single
+row, if the row can be mapped through children strategy, otherwise the parent's branch is
+regenerated.
+*/
+
+class CORE_EXPORT RefViewModelController
+{
+public:
+    explicit RefViewModelController(RefViewModel* view_model = nullptr);
+    virtual ~RefViewModelController();
+
+    void setViewModel(RefViewModel* view_model);
+
+    void setSessionModel(SessionModel* model);
+
+    void setChildrenStrategy(std::unique_ptr<ChildrenStrategyInterface> children_strategy);
+
+    void setRowStrategy(std::unique_ptr<RefRowStrategyInterface> row_strategy);
+
+    void init_view_model();
+
+    void setRootSessionItem(SessionItem* item);
+
+    SessionItem* rootSessionItem() const;
+
+    SessionModel* sessionModel();
+    const SessionModel* sessionModel() const;
+
+    std::vector<RefViewItem*> findViews(const SessionItem* item) const;
+
+protected:
+    void generate_children_views(SessionItem* parent);
+    virtual void onDataChange(SessionItem* item, int role);
+    virtual void onItemInserted(SessionItem* parent, TagRow tagrow);
+    virtual void onItemAboutToBeRemoved(SessionItem* parent, TagRow tagrow);
+    virtual void onItemRemoved(SessionItem* parent, TagRow tagrow);
+
+private:
+    struct RefViewModelControllerImpl;
+    std::unique_ptr<RefViewModelControllerImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_VIEWMODEL_REFVIEWMODELCONTROLLER_H
@@ -48,7 +48,7 @@ void PropertyViewModelController::onDataChange(SessionItem* item, int role)
     // If data change occured with GroupItem, performs cleanup and regeneration of
     // ViewItems, corresponding to groupItem's current index.
     if (auto group = dynamic_cast<GroupItem*>(item))
-        AbstractViewModelController::onItemRemoved(group, {"", 0});
+        generate_children_views(group);
 }
 
 // ----------------------------------------------------------------------------
@@ -76,5 +76,69 @@ void PropertyFlatViewModelController::onDataChange(SessionItem* item, int role)
     // If data change occured with GroupItem, performs cleanup and regeneration of
     // ViewItems, corresponding to groupItem's current index.
     if (auto group = dynamic_cast<GroupItem*>(item))
-        AbstractViewModelController::onItemRemoved(group->parent(), {"", 0});
+        generate_children_views(group->parent());
+}
+
+// ----------------------------------------------------------------------------
+
+RefDefaultViewModelController::RefDefaultViewModelController(RefViewModel* view_model)
+    : RefViewModelController(view_model)
+{
+    setRowStrategy(std::make_unique<LabelDataRowStrategy>());
+    setChildrenStrategy(std::make_unique<AllChildrenStrategy>());
+}
+
+// ----------------------------------------------------------------------------
+
+RefTopItemsViewModelController::RefTopItemsViewModelController(RefViewModel* view_model)
+    : RefViewModelController(view_model)
+{
+    setRowStrategy(std::make_unique<LabelDataRowStrategy>());
+    setChildrenStrategy(std::make_unique<TopItemsStrategy>());
+}
+
+// ----------------------------------------------------------------------------
+
+RefPropertyViewModelController::RefPropertyViewModelController(RefViewModel* view_model)
+    : RefViewModelController(view_model)
+{
+    setRowStrategy(std::make_unique<LabelDataRowStrategy>());
+    setChildrenStrategy(std::make_unique<PropertyItemsStrategy>());
+}
+
+void RefPropertyViewModelController::onDataChange(SessionItem* item, int role)
+{
+    RefViewModelController::onDataChange(item, role);
+    // If data change occured with GroupItem, performs cleanup and regeneration of
+    // ViewItems, corresponding to groupItem's current index.
+    if (auto group = dynamic_cast<GroupItem*>(item))
+        generate_children_views(group);
+}
+
+// ----------------------------------------------------------------------------
+
+RefPropertyTableViewModelController::RefPropertyTableViewModelController(
+    RefViewModel* view_model, const std::vector<std::string>& labels)
+    : RefViewModelController(view_model)
+{
+    setRowStrategy(std::make_unique<PropertiesRowStrategy>(labels));
+    setChildrenStrategy(std::make_unique<TopItemsStrategy>());
+}
+
+// ----------------------------------------------------------------------------
+
+RefPropertyFlatViewModelController::RefPropertyFlatViewModelController(RefViewModel* view_model)
+    : RefViewModelController(view_model)
+{
+    setRowStrategy(std::make_unique<LabelDataRowStrategy>());
+    setChildrenStrategy(std::make_unique<PropertyItemsFlatStrategy>());
+}
+
+void RefPropertyFlatViewModelController::onDataChange(SessionItem* item, int role)
+{
+    RefViewModelController::onDataChange(item, role);
+    // If data change occured with GroupItem, performs cleanup and regeneration of
+    // ViewItems, corresponding to groupItem's current index.
+    if (auto group = dynamic_cast<GroupItem*>(item))
+        generate_children_views(group->parent());
 }
@@ -11,12 +11,13 @@
 #define MVVM_VIEWMODEL_STANDARDVIEWMODELCONTROLLERS_H
 
 #include <mvvm/viewmodel/abstractviewmodelcontroller.h>
+#include <mvvm/viewmodel/refviewmodelcontroller.h>
 #include <string>
 #include <vector>
 
 /*!
 @file viewmodelcontrollers.h
-Collection of standard controllers for AbstractViewModel.
+Collection of standard controllers for AbstractViewModel and RefViewModel.
 */
 
 namespace ModelView
@@ -96,6 +97,58 @@ protected:
     void onDataChange(SessionItem* item, int role) override;
 };
 
+// ----------------------------------------------------------------------------
+// Controllers for RefViewModel, having the same layout as controllers above.
+// ----------------------------------------------------------------------------
+
+//! Controller for RefViewModel to show all items of SessionModel.
+
+class CORE_EXPORT RefDefaultViewModelController : public RefViewModelController
+{
+public:
+    explicit RefDefaultViewModelController(RefViewModel* view_model = nullptr);
+};
+
+//! Controller for RefViewModel to show top level items.
+
+class CORE_EXPORT RefTopItemsViewModelController : public RefViewModelController
+{
+public:
+    explicit RefTopItemsViewModelController(RefViewModel* view_model = nullptr);
+};
+
+//! Controller for RefViewModel to show item properties.
+
+class CORE_EXPORT RefPropertyViewModelController : public RefViewModelController
+{
+public:
+    explicit RefPropertyViewModelController(RefViewModel* view_model = nullptr);
+
+protected:
+    void onDataChange(SessionItem* item, int role) override;
+};
+
+//! Controller for RefViewModel to show item properties in table layout.
+
+class CORE_EXPORT RefPropertyTableViewModelController : public RefViewModelController
+{
+public:
+    RefPropertyTableViewModelController(RefViewModel* view_model = nullptr,
+                                        const std::vector<std::string>& labels = {});
+};
+
+//! Controller for RefViewModel to show item properties, with subproperties of group item moved
+//! under parent of group item.
+
+class CORE_EXPORT RefPropertyFlatViewModelController : public RefViewModelController
+{
+public:
+    explicit RefPropertyFlatViewModelController(RefViewModel* view_model = nullptr);
+
+protected:
+    void onDataChange(SessionItem* item, int role) override;
+};
+
 } // namespace ModelView
 
 #endif // MVVM_VIEWMODEL_STANDARDVIEWMODELCONTROLLERS_H
@@ -11,6 +11,7 @@
 #include <mvvm/viewmodel/propertyflatviewmodel.h>
 #include <mvvm/viewmodel/propertyviewmodel.h>
 #include <mvvm/viewmodel/propertytableviewmodel.h>
+#include <mvvm/viewmodel/refviewmodel.h>
 #include <mvvm/viewmodel/standardviewmodelcontrollers.h>
 #include <mvvm/viewmodel/standardviewmodels.h>
 #include <mvvm/viewmodel/topitemsviewmodel.h>
@@ -18,6 +19,16 @@
 
 using namespace ModelView;
 
+namespace
+{
+template <typename T> std::unique_ptr<RefViewModel> CreateRefViewModel(SessionModel* model)
+{
+    auto result = std::make_unique<RefViewModel>(std::make_unique<T>());
+    result->setSessionModel(model);
+    return result;
+}
+} // namespace
+
 std::unique_ptr<AbstractViewModel> Utils::CreateDefaultViewModel(ModelView::SessionModel* model)
 {
     auto controller = std::make_unique<DefaultViewModelController>();
@@ -45,3 +56,27 @@ std::unique_ptr<AbstractViewModel> Utils::CreatePropertyFlatViewModel(SessionMod
     return std::make_unique<PropertyFlatViewModel>(model);
 }
 
+std::unique_ptr<RefViewModel> Utils::CreateRefDefaultViewModel(SessionModel* model)
+{
+    return CreateRefViewModel<RefDefaultViewModelController>(model);
+}
+
+std::unique_ptr<RefViewModel> Utils::CreateRefPropertyViewModel(SessionModel* model)
+{
+    return CreateRefViewModel<RefPropertyViewModelController>(model);
+}
+
+std::unique_ptr<RefViewModel> Utils::CreateRefPropertyTableViewModel(SessionModel* model)
+{
+    return CreateRefViewModel<RefPropertyTableViewModelController>(model);
+}
+
+std::unique_ptr<RefViewModel> Utils::CreateRefTopItemsViewModel(SessionModel* model)
+{
+    return CreateRefViewModel<RefTopItemsViewModelController>(model);
+}
+
+std::unique_ptr<RefViewModel> Utils::CreateRefPropertyFlatViewModel(SessionModel* model)
+{
+    return CreateRefViewModel<RefPropertyFlatViewModelController>(model);
+}
@@ -18,6 +18,7 @@ namespace ModelView
 
 class SessionModel;
 class AbstractViewModel;
+class RefViewModel;
 
 namespace Utils
 {
@@ -44,6 +45,21 @@ CORE_EXPORT std::unique_ptr<AbstractViewModel> CreateTopItemsViewModel(SessionMo
 //! Subproperties of group item moved one level up.
 CORE_EXPORT std::unique_ptr<AbstractViewModel> CreatePropertyFlatViewModel(SessionModel* model);
 
+//! Creates RefViewModel with the same layout as the one of CreateDefaultViewModel.
+CORE_EXPORT std::unique_ptr<RefViewModel> CreateRefDefaultViewModel(SessionModel* model);
+
+//! Creates RefViewModel with the same layout as the one of CreatePropertyViewModel.
+CORE_EXPORT std::unique_ptr<RefViewModel> CreateRefPropertyViewModel(SessionModel* model);
+
+//! Creates RefViewModel with the same layout as the one of CreatePropertyTableViewModel.
+CORE_EXPORT std::unique_ptr<RefViewModel> CreateRefPropertyTableViewModel(SessionModel* model);
+
+//! Creates RefViewModel with the same layout as the one of CreateTopItemsViewModel.
+CORE_EXPORT std::unique_ptr<RefViewModel> CreateRefTopItemsViewModel(SessionModel* model);
+
+//! Creates RefViewModel with the same layout as the one of CreatePropertyFlatViewModel.
+CORE_EXPORT std::unique_ptr<RefViewModel> CreateRefPropertyFlatViewModel(SessionModel* model);
+
 } // namespace Utils
 
 } // namespace ModelView
@@ -25,8 +25,21 @@ QVariant ViewItem::data(int role) const
     if (!m_item)
         return QStandardItem::data(role);
 
-    if (role == Qt::DisplayRole || role == Qt::EditRole)
-        return Utils::toQtVariant(m_item->data(m_item_role));
+    if (role == Qt::DisplayRole || role == Qt::EditRole) {
+        // views ask for data on every paint, conversion of strings is done once per change
+        if (m_display_data_revision == m_item->dataRevision())
+            return m_display_data;
+
+        // other data is returned unconverted and isn't cached, since a cached copy would share the
+        // buffer of large data and force its deep copy on the next in-place modification
+        auto data = m_item->data(m_item_role);
+        if (!Utils::IsStdStringVariant(data))
+            return data;
+
+        m_display_data = Utils::toQtVariant(data);
+        m_display_data_revision = m_item->dataRevision();
+        return m_display_data;
+    }
 #if QT_VERSION >= QT_VERSION_CHECK(5, 13, 0)
     else if (role == Qt::ForegroundRole)
 #else
@@ -44,6 +44,10 @@ protected:
 
     SessionItem* m_item;
     int m_item_role; // one of roles defined in ItemDataRole
+
+private:
+    mutable QVariant m_display_data; //!< string converted for Qt, valid for given data revision
+    mutable int m_display_data_revision{-1};
 };
 
 } // namespace ModelView
@@ -0,0 +1,418 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QTimer>
+#include <algorithm>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/itemutils.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/signals/modelmapper.h>
+#include <mvvm/viewmodel/viewmodelutils.h>
+#include <mvvm/viewmodel/virtualtableviewmodel.h>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace ModelView;
+
+struct VirtualTableViewModel::VirtualTableViewModelImpl {
+    VirtualTableViewModel* view_model{nullptr};
+    SessionModel* model{nullptr};
+    SessionItem* root_item{nullptr};
+    std::vector<SessionItem*> rows;
+    std::vector<std::string> tags; //!< tags of properties shown in columns
+    QStringList labels;
+    bool user_defined_tags{false};
+
+    mutable std::unordered_map<const SessionItem*, int> row_index;
+    mutable bool is_row_index_valid{false};
+
+    // rectangle of changed cells, which wasn't reported yet
+    int first_row{-1};
+    int last_row{-1};
+    int first_column{-1};
+    int last_column{-1};
+    bool is_flush_scheduled{false};
+
+    VirtualTableViewModelImpl(VirtualTableViewModel* view_model, SessionModel* model)
+        : view_model(view_model), model(model)
+    {
+    }
+
+    SessionItem* root() const
+    {
+        if (!model)
+            return nullptr;
+        return root_item ? root_item : model->rootItem();
+    }
+
+    //! Updates rows and columns from the given top level items.
+
+    void update_layout(std::vector<SessionItem*> top_items)
+    {
+        rows = std::move(top_items);
+        is_row_index_valid = false;
+        first_row = -1;
+
+        if (!user_defined_tags) {
+            tags.clear();
+            if (!rows.empty())
+                for (auto property : Utils::SinglePropertyItems(*rows.front()))
+                    tags.push_back(rows.front()->tagOfItem(property));
+        }
+
+        labels.clear();
+        for (const auto& tag : tags) {
+            auto property = rows.empty() ? nullptr : cell_item(0, column_of_tag(tag));
+            labels.push_back(QString::fromStdString(property ? property->displayName() : tag));
+        }
+    }
+
+    int column_of_tag(const std::string& tag) const
+    {
+        auto it = std::find(tags.begin(), tags.end(), tag);
+        return it == tags.end() ? -1 : static_cast<int>(std::distance(tags.begin(), it));
+    }
+
+    //! Returns row of given item, or -1 if item isn't shown in the table.
+
+    int row_of(const SessionItem* item) const
+    {
+        if (!is_row_index_valid) {
+            row_index.clear();
+            for (size_t row = 0; row < rows.size(); ++row)
+                row_index[rows[row]] = static_cast<int>(row);
+            is_row_index_valid = true;
+        }
+        auto it = row_index.find(item);
+        return it == row_index.end() ? -1 : it->second;
+    }
+
+    //! Inserts the row of given item, rows of following items are shifted in the index.
+
+    void insert_row(int row, SessionItem* item)
+    {
+        rows.insert(std::next(rows.begin(), row), item);
+        if (is_row_index_valid)
+            for (size_t index = static_cast<size_t>(row); index < rows.size(); ++index)
+                row_index[rows[index]] = static_cast<int>(index);
+    }
+
+    //! Removes given row, rows of following items are shifted in the index.
+
+    void remove_row(int row)
+    {
+        if (is_row_index_valid)
+            row_index.erase(rows[static_cast<size_t>(row)]);
+        rows.erase(std::next(rows.begin(), row));
+        if (is_row_index_valid)
+            for (size_t index = static_cast<size_t>(row); index < rows.size(); ++index)
+                row_index[rows[index]] = static_cast<int>(index);
+    }
+
+    //! Returns the row of the top level item inserted into the root at given tagrow. The row is
+    //! found from the neighbours in the same tag. Only for the first item of the tag, top level
+    //! items of preceding tags are counted.
+
+    int row_to_insert(const SessionItem* parent, const TagRow& tagrow) const
+    {
+        if (auto previous = parent->getItem(tagrow.tag, tagrow.row - 1); previous)
+            return row_of(previous) + 1;
+        if (auto next = parent->getItem(tagrow.tag, tagrow.row + 1); next)
+            return row_of(next);
+
+        int result(0);
+        for (auto child : parent->children()) {
+            auto tag = parent->tagOfItem(child);
+            if (tag == tagrow.tag)
+                break;
+            if (!parent->isSinglePropertyTag(tag))
+                ++result;
+        }
+        return result;
+    }
+
+    //! Returns the property item shown in the given cell.
+
+    SessionItem* cell_item(int row, int column) const
+    {
+        if (row < 0 || row >= static_cast<int>(rows.size()) || column < 0
+            || column >= static_cast<int>(tags.size()))
+            return nullptr;
+
+        auto item = rows[static_cast<size_t>(row)];
+        const auto& tag = tags[static_cast<size_t>(column)];
+        return item->isTag(tag) ? item->getItem(tag) : nullptr;
+    }
+
+    //! Returns row and column of the cell showing given property item.
+
+    std::pair<int, int> cell_of(const SessionItem* property) const
+    {
+        auto parent = property ? property->parent() : nullptr;
+        if (!parent)
+            return {-1, -1};
+
+        int row = row_of(parent);
+        int column = row < 0 ? -1 : column_of_tag(parent->tagOfItem(property));
+        return column < 0 ? std::make_pair(-1, -1) : std::make_pair(row, column);
+    }
+
+    //! Adds cell to the rectangle of changed cells and schedules notification.
+
+    void add_change(int row, int column)
+    {
+        if (first_row < 0) {
+            first_row = last_row = row;
+            first_column = last_column = column;
+        } else {
+            first_row = std::min(first_row, row);
+            last_row = std::max(last_row, row);
+            first_column = std::min(first_column, column);
+            last_column = std::max(last_column, column);
+        }
+
+        if (!is_flush_scheduled) {
+            is_flush_scheduled = true;
+            QTimer::singleShot(0, view_model, [this]() { view_model->flushDataChanges(); });
+        }
+    }
+
+    void reset()
+    {
+        view_model->beginResetModel();
+        update_layout(root() ? Utils::TopLevelItems(*root()) : std::vector<SessionItem*>());
+        view_model->endResetModel();
+    }
+
+    void on_data_change(SessionItem* item)
+    {
+        auto [row, column] = cell_of(item);
+        if (row >= 0)
+            add_change(row, column);
+    }
+
+    void on_item_inserted(SessionItem* parent, const TagRow& tagrow)
+    {
+        if (parent != root()) {
+            on_data_change(parent->getItem(tagrow.tag, tagrow.row));
+            return;
+        }
+
+        if (parent->isSinglePropertyTag(tagrow.tag))
+            return;
+
+        // first row defines columns
+        if (rows.empty() && !user_defined_tags) {
+            reset();
+            return;
+        }
+
+        int row = row_to_insert(parent, tagrow);
+        view_model->beginInsertRows(QModelIndex(), row, row);
+        insert_row(row, parent->getItem(tagrow.tag, tagrow.row));
+        view_model->endInsertRows();
+    }
+
+    void on_item_about_to_be_removed(SessionItem* parent, const TagRow& tagrow)
+    {
+        if (parent != root())
+            return;
+
+        int row = row_of(parent->getItem(tagrow.tag, tagrow.row));
+        if (row < 0)
+            return;
+
+        view_model->beginRemoveRows(QModelIndex(), row, row);
+        remove_row(row);
+        view_model->endRemoveRows();
+    }
+
+    void on_item_removed(SessionItem* parent, const TagRow&)
+    {
+        // removal of property changes the content of the cell
+        if (auto row = row_of(parent); row >= 0 && !tags.empty()) {
+            add_change(row, 0);
+            add_change(row, static_cast<int>(tags.size()) - 1);
+        }
+    }
+
+    void subscribe()
+    {
+        if (!model)
+            return;
+
+        auto on_data_change = [this](SessionItem* item, int) { this->on_data_change(item); };
+        model->mapper()->setOnDataChange(on_data_change, this);
+
+        auto on_item_inserted = [this](SessionItem* item, TagRow tagrow) {
+            this->on_item_inserted(item, tagrow);
+        };
+        model->mapper()->setOnItemInserted(on_item_inserted, this);
+
+        auto on_about_to_remove = [this](SessionItem* item, TagRow tagrow) {
+            on_item_about_to_be_removed(item, tagrow);
+        };
+        model->mapper()->setOnAboutToRemoveItem(on_about_to_remove, this);
+
+        auto on_item_removed = [this](SessionItem* item, TagRow tagrow) {
+            this->on_item_removed(item, tagrow);
+        };
+        model->mapper()->setOnItemRemoved(on_item_removed, this);
+
+        // the reset is reported before the new root item is created, so rows are only removed
+        auto on_model_reset = [this](SessionModel*) {
+            root_item = nullptr;
+            view_model->beginResetModel();
+            update_layout({});
+            view_model->endResetModel();
+        };
+        model->mapper()->setOnModelReset(on_model_reset, this);
+
+        auto on_model_destroyed = [this](SessionModel*) {
+            model = nullptr;
+            root_item = nullptr;
+            reset();
+        };
+        model->mapper()->setOnModelDestroyed(on_model_destroyed, this);
+    }
+};
+
+VirtualTableViewModel::VirtualTableViewModel(SessionModel* model, QObject* parent)
+    : QAbstractTableModel(parent),
+      p_impl(std::make_unique<VirtualTableViewModelImpl>(this, model))
+{
+    p_impl->subscribe();
+    p_impl->update_layout(model ? Utils::TopLevelItems(*model->rootItem())
+                                : std::vector<SessionItem*>());
+}
+
+VirtualTableViewModel::~VirtualTableViewModel()
+{
+    if (p_impl->model)
+        p_impl->model->mapper()->unsubscribe(p_impl.get());
+}
+
+//! Sets the item which top level children will be shown as rows of the table.
+
+void VirtualTableViewModel::setRootSessionItem(SessionItem* item)
+{
+    if (item && item->model() != p_impl->model)
+        throw std::runtime_error(
+            "VirtualTableViewModel::setRootSessionItem()->Error. Item doesn't belong to a model.");
+
+    p_impl->root_item = item;
+    p_impl->reset();
+}
+
+//! Sets tags of property items to show in columns. If tags are empty, all properties of the
+//! first row will be shown.
+
+void VirtualTableViewModel::setColumnTags(const std::vector<std::string>& tags)
+{
+    p_impl->tags = tags;
+    p_impl->user_defined_tags = !tags.empty();
+    p_impl->reset();
+}
+
+int VirtualTableViewModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(p_impl->rows.size());
+}
+
+int VirtualTableViewModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(p_impl->tags.size());
+}
+
+QVariant VirtualTableViewModel::data(const QModelIndex& index, int role) const
+{
+    auto item = sessionItemFromIndex(index);
+    if (!item)
+        return QVariant();
+
+    if (role == Qt::DisplayRole || role == Qt::EditRole) {
+        auto value = item->data();
+        return value.isValid() ? Utils::toQtVariant(value)
+                               : QVariant(QString::fromStdString(item->displayName()));
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(5, 13, 0)
+    else if (role == Qt::ForegroundRole)
+#else
+    else if (role == Qt::TextColorRole)
+#endif
+        return Utils::TextColorRole(*item);
+    else if (role == Qt::CheckStateRole)
+        return Utils::CheckStateRole(*item);
+    else if (role == Qt::DecorationRole)
+        return Utils::DecorationRole(*item);
+
+    return QVariant();
+}
+
+bool VirtualTableViewModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    auto item = sessionItemFromIndex(index);
+    if (item && role == Qt::EditRole)
+        return item->setData(Utils::toCustomVariant(value));
+    return false;
+}
+
+Qt::ItemFlags VirtualTableViewModel::flags(const QModelIndex& index) const
+{
+    auto item = sessionItemFromIndex(index);
+    if (!item)
+        return QAbstractTableModel::flags(index);
+
+    Qt::ItemFlags result = Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+    if (item->data().isValid() && item->isEditable() && item->isEnabled())
+        result |= Qt::ItemIsEditable;
+    return result;
+}
+
+QVariant VirtualTableViewModel::headerData(int section, Qt::Orientation orientation,
+                                           int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0
+        && section < p_impl->labels.size())
+        return p_impl->labels.at(section);
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+//! Returns property item shown in the cell with given index.
+
+SessionItem* VirtualTableViewModel::sessionItemFromIndex(const QModelIndex& index) const
+{
+    return index.isValid() ? p_impl->cell_item(index.row(), index.column()) : nullptr;
+}
+
+//! Returns index of the cell showing given property item.
+
+QModelIndex VirtualTableViewModel::indexOfSessionItem(const SessionItem* item) const
+{
+    auto [row, column] = p_impl->cell_of(item);
+    return row >= 0 ? index(row, column) : QModelIndex();
+}
+
+//! Reports all data changes collected so far with a single dataChanged signal.
+
+void VirtualTableViewModel::flushDataChanges()
+{
+    p_impl->is_flush_scheduled = false;
+    if (p_impl->first_row < 0)
+        return;
+
+    int last_row = std::min(p_impl->last_row, rowCount() - 1);
+    int last_column = std::min(p_impl->last_column, columnCount() - 1);
+    int first_row = p_impl->first_row;
+    p_impl->first_row = -1;
+
+    if (first_row <= last_row && p_impl->first_column <= last_column)
+        dataChanged(index(first_row, p_impl->first_column), index(last_row, last_column));
+}
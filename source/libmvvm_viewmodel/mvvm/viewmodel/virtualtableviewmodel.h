@@ -0,0 +1,76 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_VIEWMODEL_VIRTUALTABLEVIEWMODEL_H
+#define MVVM_VIEWMODEL_VIRTUALTABLEVIEWMODEL_H
+
+#include <QAbstractTableModel>
+#include <memory>
+#include <mvvm/core/export.h>
+#include <string>
+#include <vector>
+
+namespace ModelView
+{
+
+class SessionModel;
+class SessionItem;
+
+/*!
+@class VirtualTableViewModel
+@brief Table view model to show properties of many items of the same type.
+
+Rows of the table represent top level items of the root item, columns represent their property
+items. Has the same layout as PropertyTableViewModel, but doesn't construct any object per
+cell: the data is taken from SessionItem's properties on request, using tags of properties
+cached per column. Only the pointer to the item is stored per row.
+
+Data changes are collected and reported with a single dataChanged signal, covering all changed
+cells, on the next iteration of the event loop, or on explicit flushDataChanges() call.
+*/
+
+class CORE_EXPORT VirtualTableViewModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    explicit VirtualTableViewModel(SessionModel* model, QObject* parent = nullptr);
+    ~VirtualTableViewModel() override;
+
+    void setRootSessionItem(SessionItem* item);
+
+    void setColumnTags(const std::vector<std::string>& tags);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    SessionItem* sessionItemFromIndex(const QModelIndex& index) const;
+
+    QModelIndex indexOfSessionItem(const SessionItem* item) const;
+
+    void flushDataChanges();
+
+private:
+    struct VirtualTableViewModelImpl;
+    std::unique_ptr<VirtualTableViewModelImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_VIEWMODEL_VIRTUALTABLEVIEWMODEL_H
@@ -33,7 +33,7 @@ void ItemsTreeView::setViewModel(std::unique_ptr<AbstractViewModel> viewModel)
     m_viewModel = std::move(viewModel);
     m_treeView->setItemDelegate(m_delegate.get());
     m_treeView->setModel(m_viewModel.get());
-    m_treeView->expandAll();
+    expand();
     m_treeView->resizeColumnToContents(0);
     set_connected(true);
 }
@@ -53,7 +53,7 @@ void ItemsTreeView::setSelected(SessionItem* item)
 void ItemsTreeView::setRootSessionItem(SessionItem* item)
 {
     m_viewModel->setRootSessionItem(item);
-    m_treeView->expandAll();
+    expand();
 }
 
 AbstractViewModel* ItemsTreeView::viewModel() const
@@ -88,6 +88,27 @@ void ItemsTreeView::set_connected(bool flag)
     else
         disconnect(selectionModel(), &QItemSelectionModel::selectionChanged, this,
                    &ItemsTreeView::onSelectionChanged);
+
+    // in lazy mode children of collapsed items are released
+    if (flag && m_viewModel->isLazyMode())
+        connect(m_treeView, &QTreeView::collapsed, this, &ItemsTreeView::onCollapsed,
+                Qt::UniqueConnection);
+}
+
+//! Expands all items. In lazy mode only the top level is shown, to avoid fetching whole model.
+
+void ItemsTreeView::expand()
+{
+    if (!m_viewModel->isLazyMode())
+        m_treeView->expandAll();
+}
+
+//! Releases children of collapsed item in lazy mode.
+
+void ItemsTreeView::onCollapsed(const QModelIndex& index)
+{
+    if (m_viewModel && m_viewModel->isLazyMode())
+        m_viewModel->releaseChildren(index);
 }
 
 QTreeView* ItemsTreeView::treeView()
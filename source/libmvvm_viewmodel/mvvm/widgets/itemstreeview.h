@@ -17,6 +17,7 @@
 class QTreeView;
 class QItemSelection;
 class QItemSelectionModel;
+class QModelIndex;
 
 namespace ModelView
 {
@@ -52,12 +53,15 @@ signals:
 
 private slots:
     void onSelectionChanged(const QItemSelection&, const QItemSelection&);
+    void onCollapsed(const QModelIndex& index);
 
 private:
     QItemSelectionModel* selectionModel();
 
     void set_connected(bool flag);
 
+    void expand();
+
     QTreeView* m_treeView;
     std::unique_ptr<AbstractViewModel> m_viewModel;
     std::unique_ptr<ViewModelDelegate> m_delegate;
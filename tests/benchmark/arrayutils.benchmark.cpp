@@ -0,0 +1,100 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark.h"
+#include <algorithm>
+#include <mvvm/utils/arrayutils.h>
+#include <random>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+
+std::vector<double> random_values(size_t size)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<double> result(size);
+    std::generate(result.begin(), result.end(), [&]() { return distribution(generator); });
+    return result;
+}
+
+//! Reports time of the operation done by Utils function against the one of the plain loop.
+
+void compare(const std::string& name, size_t size, const std::function<void()>& scalar,
+             const std::function<void()>& utils)
+{
+    auto reference_time = Benchmark::Measure(scalar);
+    auto label = name + " " + std::to_string(size);
+    Benchmark::Report(label + " scalar", reference_time);
+    Benchmark::Report(label + " Utils", Benchmark::Measure(utils), reference_time);
+}
+
+} // namespace
+
+void Benchmark::RunArrayUtils()
+{
+    for (size_t size : {size_t(1) << 20, size_t(4096) * 4096}) {
+        auto values = random_values(size);
+
+        compare(
+            "MinMax", size,
+            [&values]() {
+                double lower = values.front(), upper = values.front();
+                for (auto x : values) {
+                    lower = std::min(lower, x);
+                    upper = std::max(upper, x);
+                }
+                Consume(lower + upper);
+            },
+            [&values]() {
+                auto [lower, upper] = Utils::MinMax(values);
+                Consume(lower + upper);
+            });
+
+        compare(
+            "Sum", size,
+            [&values]() {
+                double result{0.0};
+                for (auto x : values)
+                    result += x;
+                Consume(result);
+            },
+            [&values]() { Consume(Utils::Sum(values)); });
+
+        compare(
+            "AffineTransform", size,
+            [&values]() {
+                for (auto& x : values)
+                    x = x * 0.5 + 0.25;
+            },
+            [&values]() { Utils::AffineTransform(values, 0.5, 0.25); });
+
+        compare(
+            "Clamp", size,
+            [&values]() {
+                for (auto& x : values)
+                    x = std::clamp(x, -0.5, 0.5);
+            },
+            [&values]() { Utils::Clamp(values, -0.5, 0.5); });
+
+        compare(
+            "Histogram", size,
+            [&values]() {
+                std::vector<int> result(100, 0);
+                for (auto x : values)
+                    if (x >= -1.0 && x <= 1.0)
+                        ++result[std::min(static_cast<size_t>((x + 1.0) * 50.0), size_t(99))];
+                Consume(result.front());
+            },
+            [&values]() { Consume(Utils::Histogram(values, 100, -1.0, 1.0).front()); });
+    }
+}
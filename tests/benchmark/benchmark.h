@@ -0,0 +1,66 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_BENCHMARK_BENCHMARK_H
+#define MVVM_BENCHMARK_BENCHMARK_H
+
+#include <functional>
+#include <string>
+
+//! Minimal benchmark driver. Measures wall time of functions and prints the report to the
+//! standard output. Meaningful numbers require Release build.
+
+namespace Benchmark
+{
+
+//! Returns the best time of given number of runs of the function, in milliseconds.
+double Measure(const std::function<void()>& func, int runs = 5);
+
+//! Prints the time of the benchmark, and the speed-up against the reference time, if given.
+void Report(const std::string& name, double time, double reference_time = 0.0);
+
+//! Prints the number of operations per second, given the time of count operations.
+void ReportRate(const std::string& name, double time, int count);
+
+//! Prints the amount of memory in megabytes.
+void ReportMemory(const std::string& name, long bytes);
+
+//! Returns resident memory of the process in bytes, or zero if it isn't known on this platform.
+long ResidentMemory();
+
+//! Keeps the value alive, so computation of it isn't optimized away.
+void Consume(double value);
+
+//! Numeric operations of Utils namespace against plain loops.
+void RunArrayUtils();
+
+//! Content access and assignment of data items.
+void RunDataItems();
+
+//! Json serialization of models, validation of keys against the comparison of key lists.
+void RunJson();
+
+//! Data changes and lookups in view models of several sizes, lookups against the scan of views.
+void RunViewModel();
+
+//! Construction of RefViewModel against AbstractViewModel.
+void RunRefViewModel();
+
+//! VirtualTableViewModel against PropertyTableViewModel.
+void RunTableViewModel();
+
+//! Paint path of Qt views showing view models.
+void RunPaint();
+
+//! Filling of colormap data from Data2DItem.
+void RunColorMap();
+
+} // namespace Benchmark
+
+#endif // MVVM_BENCHMARK_BENCHMARK_H
@@ -0,0 +1,64 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark.h"
+#include "qcustomplot.h"
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/plotting/colormapdata.h>
+#include <mvvm/plotting/data2dplotcontroller.h>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data2ditem.h>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+const int nx = 2048;
+const int ny = 2048;
+} // namespace
+
+void Benchmark::RunColorMap()
+{
+    const std::vector<double> values(static_cast<size_t>(nx) * ny, 1.0);
+    const std::string size = " " + std::to_string(nx) + "x" + std::to_string(ny);
+
+    // filling cell by cell, as it was done before rows were filled in a single pass
+    ColorMapData data(nx, ny, QCPRange(0.0, 1.0), QCPRange(0.0, 1.0));
+    auto cell_time = Measure([&]() {
+        for (int iy = 0; iy < ny; ++iy)
+            for (int ix = 0; ix < nx; ++ix)
+                data.setCell(ix, iy, values[static_cast<size_t>(ix + iy * nx)]);
+    });
+    Report("QCPColorMapData::setCell per cell" + size, cell_time);
+    auto row_time = Measure([&]() {
+        for (int iy = 0; iy < ny; ++iy)
+            data.setRow(0, iy, values.data() + iy * nx, nx);
+    });
+    Report("ColorMapData::setRow" + size, row_time, cell_time);
+
+    // complete update of the colormap on content change, the plot is large enough to show
+    // all cells without reducing the level of detail
+    SessionModel model;
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(nx, 0.0, 1.0), FixedBinAxisItem::create(ny, 0.0, 1.0));
+    QCustomPlot custom_plot;
+    custom_plot.resize(nx, ny);
+    Data2DPlotController controller(new QCPColorMap(custom_plot.xAxis, custom_plot.yAxis));
+    controller.setItem(item);
+    double scale{1.0};
+    auto update_time = Measure([&]() {
+        scale = -scale;
+        item->updateContent([scale](std::vector<double>& content) {
+            for (auto& x : content)
+                x = scale;
+        });
+    });
+    Report("Data2DPlotController update on content change" + size, update_time);
+}
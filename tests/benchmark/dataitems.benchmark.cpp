@@ -0,0 +1,53 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark.h"
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data2ditem.h>
+#include <mvvm/utils/arrayutils.h>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+const int nx = 4096;
+const int ny = 4096;
+} // namespace
+
+void Benchmark::RunDataItems()
+{
+    SessionModel model;
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(nx, 0.0, 1.0), FixedBinAxisItem::create(ny, 0.0, 1.0));
+
+    // alternating content, so every call changes the data
+    const std::vector<std::vector<double>> values = {
+        std::vector<double>(static_cast<size_t>(nx) * ny, 1.0),
+        std::vector<double>(static_cast<size_t>(nx) * ny, 2.0)};
+    const std::string size = " " + std::to_string(nx) + "x" + std::to_string(ny);
+    size_t run{0};
+
+    auto copy_time = Measure([&]() {
+        auto buffer = values[++run % 2];
+        item->setContent(buffer);
+    });
+    Report("Data2DItem::setContent copy" + size, copy_time);
+    auto move_time = Measure([&]() {
+        auto buffer = values[++run % 2];
+        item->setContent(std::move(buffer));
+    });
+    Report("Data2DItem::setContent move" + size, move_time, copy_time);
+
+    auto content_time = Measure([&]() { Consume(Utils::Sum(item->content())); });
+    Report("Data2DItem::content sum" + size, content_time);
+    auto ref_time = Measure([&]() { Consume(Utils::Sum(item->contentRef())); });
+    Report("Data2DItem::contentRef sum" + size, ref_time, content_time);
+}
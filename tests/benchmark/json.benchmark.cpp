@@ -0,0 +1,78 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark.h"
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QStringList>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/jsonmodelconverter.h>
+#include <mvvm/serialization/jsonutils.h>
+#include <mvvm/standarditems/vectoritem.h>
+#include <utility>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+const int n_items = 10000;
+
+//! Collects all json objects of the document together with their sorted keys, which the validation
+//! of objects expects.
+
+void collect_objects(const QJsonValue& value,
+                     std::vector<std::pair<QJsonObject, QStringList>>& result)
+{
+    if (value.isObject()) {
+        auto object = value.toObject();
+        result.emplace_back(object, object.keys());
+        for (const auto& child : object)
+            collect_objects(child, result);
+    } else if (value.isArray()) {
+        for (const auto& child : value.toArray())
+            collect_objects(child, result);
+    }
+}
+
+} // namespace
+
+void Benchmark::RunJson()
+{
+    SessionModel model;
+    for (int i = 0; i < n_items; ++i)
+        model.insertItem<VectorItem>();
+    const std::string size = " " + std::to_string(n_items) + " vectors";
+
+    JsonModelConverter converter;
+    QJsonObject json;
+    Report("JsonModelConverter::model_to_json" + size,
+           Measure([&]() { converter.model_to_json(model, json); }));
+
+    SessionModel reco_model;
+    Report("JsonModelConverter::json_to_model" + size, Measure([&]() {
+               reco_model.clear();
+               converter.json_to_model(json, reco_model);
+           }));
+
+    // validation of keys of every object against the old comparison with the sorted list of keys
+    std::vector<std::pair<QJsonObject, QStringList>> objects;
+    collect_objects(json, objects);
+    auto reference_time = Measure([&objects]() {
+        for (const auto& [object, keys] : objects)
+            Consume(object.keys() == keys);
+    });
+    auto time = Measure([&objects]() {
+        for (const auto& [object, keys] : objects)
+            Consume(JsonUtils::HasExactKeys(object, keys));
+    });
+    const std::string count = " " + std::to_string(objects.size()) + " objects";
+    Report("QJsonObject::keys() comparison" + count, reference_time);
+    Report("JsonUtils::HasExactKeys" + count, time, reference_time);
+}
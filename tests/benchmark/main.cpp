@@ -0,0 +1,110 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark.h"
+#include <QApplication>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace
+{
+volatile double sink{0.0};
+}
+
+double Benchmark::Measure(const std::function<void()>& func, int runs)
+{
+    double result{0.0};
+    for (int run = 0; run < runs; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto elapsed = std::chrono::duration<double, std::milli>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+        if (run == 0 || elapsed < result)
+            result = elapsed;
+    }
+    return result;
+}
+
+void Benchmark::Report(const std::string& name, double time, double reference_time)
+{
+    std::cout << std::left << std::setw(60) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(3) << time << " ms";
+    if (reference_time > 0.0 && time > 0.0)
+        std::cout << std::setw(10) << std::setprecision(2) << reference_time / time << "x";
+    std::cout << std::endl;
+}
+
+void Benchmark::ReportRate(const std::string& name, double time, int count)
+{
+    std::cout << std::left << std::setw(60) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(0) << (time > 0.0 ? count * 1000.0 / time : 0.0) << " /s"
+              << std::endl;
+}
+
+void Benchmark::ReportMemory(const std::string& name, long bytes)
+{
+    std::cout << std::left << std::setw(60) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << bytes / (1024.0 * 1024.0) << " MB" << std::endl;
+}
+
+long Benchmark::ResidentMemory()
+{
+#ifdef __linux__
+    long pages{0};
+    std::ifstream statm("/proc/self/statm");
+    statm >> pages >> pages;
+    return pages * sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+void Benchmark::Consume(double value)
+{
+    sink = sink + value;
+}
+
+//! Runs benchmark groups given on the command line, or all groups.
+
+int main(int argc, char** argv)
+{
+    // plotting benchmarks need widgets, QT_QPA_PLATFORM=offscreen allows running without display
+    QApplication app(argc, argv);
+    Q_UNUSED(app)
+
+    const std::map<std::string, std::function<void()>> groups = {
+        {"arrayutils", Benchmark::RunArrayUtils},
+        {"colormap", Benchmark::RunColorMap},
+        {"dataitems", Benchmark::RunDataItems},
+        {"json", Benchmark::RunJson},
+        {"paint", Benchmark::RunPaint},
+        {"refviewmodel", Benchmark::RunRefViewModel},
+        {"tableviewmodel", Benchmark::RunTableViewModel},
+        {"viewmodel", Benchmark::RunViewModel}};
+
+    for (const auto& [name, func] : groups) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i)
+            selected |= name == argv[i];
+        if (!selected)
+            continue;
+        std::cout << "--- " << name << std::endl;
+        func();
+    }
+
+    return 0;
+}
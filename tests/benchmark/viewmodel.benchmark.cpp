@@ -0,0 +1,190 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark.h"
+#include <QPixmap>
+#include <QScrollBar>
+#include <QTreeView>
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/standarditems/vectoritem.h>
+#include <mvvm/viewmodel/defaultviewmodel.h>
+#include <mvvm/viewmodel/refviewmodel.h>
+#include <mvvm/viewmodel/standardviewmodels.h>
+#include <mvvm/viewmodel/viewmodelutils.h>
+#include <mvvm/viewmodel/virtualtableviewmodel.h>
+#include <vector>
+
+using namespace ModelView;
+
+namespace
+{
+const int n_items = 10000;
+
+//! Reports memory of the view model created by the factory function, returns the view model.
+
+template <typename T>
+std::unique_ptr<T> measure_memory(const std::string& name, SessionModel* model,
+                                  std::unique_ptr<T> (*factory)(SessionModel*))
+{
+    auto memory = Benchmark::ResidentMemory();
+    auto result = factory(model);
+    Benchmark::ReportMemory(name + " memory", Benchmark::ResidentMemory() - memory);
+    return result;
+}
+
+//! Reports time to create and destroy the view model by the factory function.
+
+template <typename T>
+void measure_time(const std::string& name, SessionModel* model,
+                  std::unique_ptr<T> (*factory)(SessionModel*))
+{
+    Benchmark::Report(name + " construction and destruction",
+                      Benchmark::Measure([model, factory]() { factory(model); }));
+}
+
+std::unique_ptr<VirtualTableViewModel> create_virtual_table(SessionModel* model)
+{
+    return std::make_unique<VirtualTableViewModel>(model);
+}
+
+//! Reports time to query display data of all cells of the table.
+
+void measure_data(const std::string& name, const QAbstractItemModel& view_model)
+{
+    Benchmark::Report(name + " data of all cells", Benchmark::Measure([&view_model]() {
+                          for (int row = 0; row < view_model.rowCount(); ++row)
+                              for (int col = 0; col < view_model.columnCount(); ++col)
+                                  view_model.data(view_model.index(row, col));
+                      }));
+}
+
+} // namespace
+
+void Benchmark::RunViewModel()
+{
+    for (int n_vectors : {1000, 10000, 100000}) {
+        SessionModel model;
+        std::vector<VectorItem*> items;
+        for (int i = 0; i < n_vectors; ++i)
+            items.push_back(model.insertItem<VectorItem>());
+        const std::string size = " " + std::to_string(n_vectors) + " vectors";
+
+        DefaultViewModel view_model(&model);
+        double value{0.0};
+        auto edit_time = Measure([&]() {
+            value += 1.0;
+            for (auto item : items)
+                item->setProperty(VectorItem::P_X, value);
+        });
+        ReportRate("DefaultViewModel edits" + size, edit_time, n_vectors);
+
+        // the scan of the whole view model is too slow to look up every item
+        const int n_lookups = 100;
+        std::vector<SessionItem*> properties;
+        for (int i = 0; i < n_lookups; ++i)
+            properties.push_back(items[i * n_vectors / n_lookups]->getItem(VectorItem::P_X));
+
+        auto scan_time = Measure(
+            [&]() {
+                for (auto item : properties)
+                    Consume(Utils::findViews(&view_model, item).size());
+            },
+            1);
+        auto lookup_time = Measure([&]() {
+            for (auto item : properties)
+                Consume(view_model.indexOfSessionItem(item).size());
+        });
+        Report("Utils::findViews" + size + ", 100 lookups", scan_time);
+        Report("DefaultViewModel::indexOfSessionItem" + size + ", 100 lookups", lookup_time,
+               scan_time);
+    }
+}
+
+//! Standard view models against the ones without QStandardItem for every cell.
+
+void Benchmark::RunRefViewModel()
+{
+    SessionModel model;
+    for (int i = 0; i < n_items; ++i)
+        model.insertItem<VectorItem>();
+    const std::string size = " " + std::to_string(n_items) + " vectors";
+
+    const std::string name_default = "DefaultViewModel" + size;
+    const std::string name_ref_default = "RefViewModel, default layout" + size;
+    const std::string name_table = "PropertyTableViewModel" + size;
+    const std::string name_ref_table = "RefViewModel, property table layout" + size;
+
+    {
+        // view models are kept alive, so the memory of the next one isn't taken from freed memory
+        auto x1 = measure_memory(name_default, &model, Utils::CreateDefaultViewModel);
+        auto x2 = measure_memory(name_ref_default, &model, Utils::CreateRefDefaultViewModel);
+        auto x3 = measure_memory(name_table, &model, Utils::CreatePropertyTableViewModel);
+        auto x4 = measure_memory(name_ref_table, &model, Utils::CreateRefPropertyTableViewModel);
+    }
+
+    measure_time(name_default, &model, Utils::CreateDefaultViewModel);
+    measure_time(name_ref_default, &model, Utils::CreateRefDefaultViewModel);
+    measure_time(name_table, &model, Utils::CreatePropertyTableViewModel);
+    measure_time(name_ref_table, &model, Utils::CreateRefPropertyTableViewModel);
+}
+
+//! Table view model without objects per cell against PropertyTableViewModel.
+
+void Benchmark::RunTableViewModel()
+{
+    SessionModel model;
+    for (int i = 0; i < n_items; ++i)
+        model.insertItem<VectorItem>();
+    const std::string size = " " + std::to_string(n_items) + " vectors";
+
+    const std::string name_table = "PropertyTableViewModel" + size;
+    const std::string name_virtual = "VirtualTableViewModel" + size;
+
+    auto table = measure_memory(name_table, &model, Utils::CreatePropertyTableViewModel);
+    auto virtual_table = measure_memory(name_virtual, &model, create_virtual_table);
+
+    measure_time(name_table, &model, Utils::CreatePropertyTableViewModel);
+    measure_time(name_virtual, &model, create_virtual_table);
+
+    measure_data(name_table, *table);
+    measure_data(name_virtual, *virtual_table);
+}
+
+//! Display data queries and scrolling of tree view with string properties.
+
+void Benchmark::RunPaint()
+{
+    const int n_rows = 100000;
+    SessionModel model;
+    for (int i = 0; i < n_rows; ++i) {
+        auto item = model.insertItem<CompoundItem>();
+        item->setDisplayName("item " + std::to_string(i));
+        item->addProperty("name", "value " + std::to_string(i));
+    }
+    const std::string size = " " + std::to_string(n_rows) + " rows";
+
+    DefaultViewModel view_model(&model);
+    measure_data("DefaultViewModel" + size, view_model);
+
+    QTreeView view;
+    view.setModel(&view_model);
+    view.resize(1920, 1080);
+    QPixmap pixmap(view.size());
+    auto scroll_bar = view.verticalScrollBar();
+    const int n_pages = 100;
+    auto scroll_time = Measure([&view, &pixmap, scroll_bar]() {
+        for (int page = 0; page < n_pages; ++page) {
+            scroll_bar->setValue(scroll_bar->maximum() * page / (n_pages - 1));
+            view.render(&pixmap);
+        }
+    });
+    ReportRate("QTreeView scrolling of DefaultViewModel" + size + ", 1920x1080 pages", scroll_time,
+               n_pages);
+}
@@ -0,0 +1,119 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mvvm/utils/arrayutils.h>
+#include <numeric>
+
+using namespace ModelView;
+
+class ArrayUtilsTest : public ::testing::Test
+{
+public:
+    ~ArrayUtilsTest();
+
+    //! Returns vector of given size with values of both signs. Sizes which are not multiple of
+    //! vector register width check handling of the tails.
+    static std::vector<double> testData(size_t size)
+    {
+        std::vector<double> result(size);
+        for (size_t i = 0; i < size; ++i)
+            result[i] = std::sin(1.3 * i) * 10.0;
+        return result;
+    }
+
+    static std::vector<size_t> testSizes() { return {1, 2, 3, 4, 5, 7, 8, 9, 1001}; }
+};
+
+ArrayUtilsTest::~ArrayUtilsTest() = default;
+
+TEST_F(ArrayUtilsTest, minMax)
+{
+    EXPECT_EQ(Utils::MinMax({}), std::make_pair(0.0, 0.0));
+
+    for (auto size : testSizes()) {
+        auto data = testData(size);
+        auto [lower, upper] = std::minmax_element(data.begin(), data.end());
+        EXPECT_EQ(Utils::MinMax(data), std::make_pair(*lower, *upper));
+    }
+
+    // NaN values are ignored
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(Utils::MinMax({nan, 1.0, 2.0, nan, -3.0, 4.0, nan}), std::make_pair(-3.0, 4.0));
+    EXPECT_EQ(Utils::MinMax({nan}), std::make_pair(0.0, 0.0));
+}
+
+TEST_F(ArrayUtilsTest, sum)
+{
+    EXPECT_EQ(Utils::Sum({}), 0.0);
+
+    for (auto size : testSizes()) {
+        auto data = testData(size);
+        EXPECT_NEAR(Utils::Sum(data), std::accumulate(data.begin(), data.end(), 0.0), 1e-10);
+    }
+}
+
+TEST_F(ArrayUtilsTest, affineTransform)
+{
+    for (auto size : testSizes()) {
+        auto data = testData(size);
+        auto expected = data;
+        for (auto& x : expected)
+            x = x * 2.5 - 1.0;
+        Utils::AffineTransform(data, 2.5, -1.0);
+        EXPECT_EQ(data, expected);
+    }
+}
+
+TEST_F(ArrayUtilsTest, log10)
+{
+    std::vector<double> data = {100.0, 1.0, 0.0, -1.0, 1e-5};
+    Utils::Log10(data, 1e-3);
+    std::vector<double> expected = {2.0, 0.0, -3.0, -3.0, -3.0};
+    ASSERT_EQ(data.size(), expected.size());
+    for (size_t i = 0; i < data.size(); ++i)
+        EXPECT_DOUBLE_EQ(data[i], expected[i]);
+
+    EXPECT_THROW(Utils::Log10(data, 0.0), std::runtime_error);
+}
+
+TEST_F(ArrayUtilsTest, clamp)
+{
+    for (auto size : testSizes()) {
+        auto data = testData(size);
+        auto expected = data;
+        for (auto& x : expected)
+            x = std::clamp(x, -2.0, 3.0);
+        Utils::Clamp(data, -2.0, 3.0);
+        EXPECT_EQ(data, expected);
+    }
+
+    // NaN values are kept
+    std::vector<double> data = {std::numeric_limits<double>::quiet_NaN(), -5.0, 5.0};
+    Utils::Clamp(data, 0.0, 1.0);
+    EXPECT_TRUE(std::isnan(data[0]));
+    EXPECT_EQ(data[1], 0.0);
+    EXPECT_EQ(data[2], 1.0);
+
+    EXPECT_THROW(Utils::Clamp(data, 1.0, 0.0), std::runtime_error);
+}
+
+TEST_F(ArrayUtilsTest, histogram)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> data = {0.0, 0.5, 1.0, 1.5, 2.0, -1.0, 3.0, nan};
+    EXPECT_EQ(Utils::Histogram(data, 2, 0.0, 2.0), std::vector<int>({2, 3}));
+    EXPECT_EQ(Utils::Histogram(data, 1, -1.0, 3.0), std::vector<int>({7}));
+
+    EXPECT_THROW(Utils::Histogram(data, 0, 0.0, 1.0), std::runtime_error);
+    EXPECT_THROW(Utils::Histogram(data, 1, 1.0, 1.0), std::runtime_error);
+}
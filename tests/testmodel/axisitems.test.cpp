@@ -83,3 +83,74 @@ TEST_F(AxisItemsTest, fixedBinAxisRange)
     EXPECT_EQ(lower, 1.0);
     EXPECT_EQ(upper, 4.0);
 }
+
+//! Access to single bins of fixed bin axis.
+
+TEST_F(AxisItemsTest, fixedBinAxisBins)
+{
+    auto axis = FixedBinAxisItem::create(4, 0.0, 4.0);
+    EXPECT_EQ(axis->binCenter(0), 0.5);
+    EXPECT_EQ(axis->binCenter(3), 3.5);
+    EXPECT_EQ(axis->front(), 0.5);
+    EXPECT_EQ(axis->back(), 3.5);
+
+    EXPECT_EQ(axis->findBin(-0.1), -1);
+    EXPECT_EQ(axis->findBin(0.0), 0);
+    EXPECT_EQ(axis->findBin(0.9), 0);
+    EXPECT_EQ(axis->findBin(1.0), 1);
+    EXPECT_EQ(axis->findBin(4.0), 3);
+    EXPECT_EQ(axis->findBin(4.1), -1);
+}
+
+//! Initial state of variable bin axis.
+
+TEST_F(AxisItemsTest, variableBinAxisInitialState)
+{
+    VariableBinAxisItem axis;
+    EXPECT_EQ(axis.binEdges(), std::vector<double>({0.0, 1.0}));
+    EXPECT_EQ(axis.binCenters(), std::vector<double>({0.5}));
+    EXPECT_EQ(axis.size(), 1);
+    EXPECT_FALSE(axis.getItem(VariableBinAxisItem::P_NBINS)->isEditable());
+}
+
+//! Variable bin axis created from bin edges.
+
+TEST_F(AxisItemsTest, variableBinAxisFactory)
+{
+    EXPECT_THROW(VariableBinAxisItem::create({1.0}), std::runtime_error);
+    EXPECT_THROW(VariableBinAxisItem::create({1.0, 3.0, 2.0}), std::runtime_error);
+    EXPECT_THROW(VariableBinAxisItem::create({1.0, 1.0}), std::runtime_error);
+
+    auto axis = VariableBinAxisItem::create({0.0, 1.0, 3.0, 7.0});
+    EXPECT_EQ(axis->size(), 3);
+    EXPECT_EQ(axis->range(), std::make_pair(0.0, 7.0));
+    EXPECT_EQ(axis->binCenters(), std::vector<double>({0.5, 2.0, 5.0}));
+    EXPECT_EQ(axis->binCenter(1), 2.0);
+    EXPECT_EQ(axis->front(), 0.5);
+    EXPECT_EQ(axis->back(), 5.0);
+
+    EXPECT_EQ(axis->findBin(-1.0), -1);
+    EXPECT_EQ(axis->findBin(0.0), 0);
+    EXPECT_EQ(axis->findBin(1.0), 1);
+    EXPECT_EQ(axis->findBin(2.9), 1);
+    EXPECT_EQ(axis->findBin(6.0), 2);
+    EXPECT_EQ(axis->findBin(7.0), 2);
+    EXPECT_EQ(axis->findBin(7.5), -1);
+}
+
+//! Axis without bins reports its range bounds as front and back, bin access throws.
+
+TEST_F(AxisItemsTest, axisWithoutBins)
+{
+    auto axis = FixedBinAxisItem::create(0, 1.0, 2.0);
+    EXPECT_EQ(axis->size(), 0);
+    EXPECT_TRUE(axis->binCenters().empty());
+    EXPECT_EQ(axis->front(), 1.0);
+    EXPECT_EQ(axis->back(), 2.0);
+    EXPECT_THROW(axis->binCenter(0), std::runtime_error);
+    EXPECT_EQ(axis->findBin(1.5), -1);
+
+    auto variable_axis = VariableBinAxisItem::create({0.0, 1.0});
+    EXPECT_THROW(variable_axis->binCenter(1), std::runtime_error);
+    EXPECT_THROW(variable_axis->binCenter(-1), std::runtime_error);
+}
@@ -0,0 +1,186 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QColor>
+#include <mvvm/model/comboproperty.h>
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/externalproperty.h>
+#include <mvvm/model/itemfactory.h>
+#include <mvvm/model/numericarray.h>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/serialization/binaryitembackupstrategy.h>
+#include <mvvm/standarditems/standarditemcatalogue.h>
+#include <cmath>
+#include <vector>
+
+using namespace ModelView;
+
+class BinaryItemBackupStrategyTest : public ::testing::Test
+{
+public:
+    BinaryItemBackupStrategyTest()
+        : m_factory(std::make_unique<ItemFactory>(CreateStandardItemCatalogue()))
+    {
+    }
+    ~BinaryItemBackupStrategyTest();
+
+    std::unique_ptr<BinaryItemBackupStrategy> createBackupStrategy()
+    {
+        return std::make_unique<BinaryItemBackupStrategy>(m_factory.get());
+    }
+
+    std::unique_ptr<ItemFactory> m_factory;
+};
+
+BinaryItemBackupStrategyTest::~BinaryItemBackupStrategyTest() = default;
+
+//! Saving/restoring PropertyItem.
+
+TEST_F(BinaryItemBackupStrategyTest, propertyItem)
+{
+    auto strategy = createBackupStrategy();
+
+    PropertyItem item;
+    item.setData(42.0);
+
+    strategy->saveItem(&item);
+    auto restored = strategy->restoreItem();
+
+    EXPECT_EQ(item.modelType(), restored->modelType());
+    EXPECT_EQ(item.identifier(), restored->identifier());
+    EXPECT_EQ(item.data(), restored->data());
+}
+
+//! Saving/restoring CompoundItem.
+
+TEST_F(BinaryItemBackupStrategyTest, compoundItem)
+{
+    auto strategy = createBackupStrategy();
+
+    CompoundItem item;
+    auto property = item.addProperty("thickness", 42.0);
+
+    strategy->saveItem(&item);
+    auto restored = strategy->restoreItem();
+
+    EXPECT_EQ(item.modelType(), restored->modelType());
+    EXPECT_EQ(item.identifier(), restored->identifier());
+    EXPECT_EQ(restored->getItem("thickness")->data(), property->data());
+    EXPECT_EQ(restored->getItem("thickness")->identifier(), property->identifier());
+}
+
+//! Saving/restoring CustomItem.
+
+TEST_F(BinaryItemBackupStrategyTest, customItem)
+{
+    auto strategy = createBackupStrategy();
+
+    const std::string model_type(Constants::BaseType);
+
+    // creating parent with one child
+    auto parent = std::make_unique<SessionItem>(model_type);
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child = new SessionItem(model_type);
+    child->setDisplayName("child_name");
+    parent->insertItem(child, TagRow::append());
+
+    // creating copy
+    strategy->saveItem(parent.get());
+    auto reco_parent = strategy->restoreItem();
+
+    EXPECT_EQ(reco_parent->childrenCount(), 1);
+    EXPECT_EQ(reco_parent->modelType(), model_type);
+    EXPECT_EQ(reco_parent->displayName(), "parent_name");
+    EXPECT_EQ(reco_parent->identifier(), parent->identifier());
+    EXPECT_EQ(reco_parent->defaultTag(), "defaultTag");
+    EXPECT_EQ(reco_parent->model(), nullptr);
+
+    // checking child reconstruction
+    auto reco_child = reco_parent->getItem("defaultTag");
+    EXPECT_EQ(reco_child->parent(), reco_parent.get());
+    EXPECT_EQ(reco_child->childrenCount(), 0);
+    EXPECT_EQ(reco_child->modelType(), model_type);
+    EXPECT_EQ(reco_child->displayName(), "child_name");
+    EXPECT_EQ(reco_child->identifier(), child->identifier());
+    EXPECT_EQ(reco_child->defaultTag(), "");
+}
+
+//! Saving/restoring item with all supported variants. Doubles should be restored bit-exact.
+
+TEST_F(BinaryItemBackupStrategyTest, variants)
+{
+    auto strategy = createBackupStrategy();
+
+    CompoundItem item;
+    item.addProperty("bool", true);
+    item.addProperty("int", 42);
+    item.addProperty("string", "abc");
+    item.addProperty("double", std::nextafter(1.0 / 3.0, 1.0));
+    item.addProperty("vector", std::vector<double>{0.1, std::sqrt(2.0), -1e-300});
+    item.addProperty("combo", ComboProperty::createFrom({"a1", "a2", "a3"}, "a2"));
+    item.addProperty("color", QColor(Qt::red));
+    item.addProperty("extprop", ExternalProperty("text", QColor(Qt::green), "id"));
+
+    strategy->saveItem(&item);
+    auto restored = strategy->restoreItem();
+
+    for (auto name : {"bool", "int", "string", "double", "vector", "combo", "color", "extprop"}) {
+        EXPECT_EQ(restored->getItem(name)->data(), item.getItem(name)->data());
+        EXPECT_EQ(restored->getItem(name)->data(ItemDataRole::LIMITS),
+                  item.getItem(name)->data(ItemDataRole::LIMITS));
+    }
+}
+
+//! Saving/restoring large array with compression enabled.
+
+TEST_F(BinaryItemBackupStrategyTest, compressedArray)
+{
+    BinaryItemBackupStrategy strategy(m_factory.get(), /*compress*/ true);
+
+    std::vector<double> values(10000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = std::sin(0.01 * i);
+
+    PropertyItem item;
+    item.setData(QVariant::fromValue(values));
+
+    strategy.saveItem(&item);
+    auto restored = strategy.restoreItem();
+
+    EXPECT_EQ(restored->data().value<std::vector<double>>(), values);
+    EXPECT_EQ(restored->identifier(), item.identifier());
+}
+
+//! Saving/restoring numeric arrays of all element types.
+
+TEST_F(BinaryItemBackupStrategyTest, numericArrays)
+{
+    BinaryItemBackupStrategy strategy(m_factory.get(), /*compress*/ true);
+
+    std::vector<float> float_values(2000);
+    for (size_t i = 0; i < float_values.size(); ++i)
+        float_values[i] = static_cast<float>(std::sin(0.01 * i));
+
+    CompoundItem item;
+    item.addProperty("float32", NumericArray(float_values));
+    item.addProperty("float64", NumericArray(std::vector<double>{0.1, 2.0}));
+    item.addProperty("int32", NumericArray(std::vector<int32_t>{-1, 42}));
+
+    strategy.saveItem(&item);
+    auto restored = strategy.restoreItem();
+
+    for (auto name : {"float32", "float64", "int32"}) {
+        auto array = restored->getItem(name)->data().value<NumericArray>();
+        EXPECT_EQ(array, item.getItem(name)->data().value<NumericArray>());
+    }
+    EXPECT_EQ(restored->getItem("float32")->data().value<NumericArray>().elementType(),
+              NumericArray::ElementType::FLOAT32);
+}
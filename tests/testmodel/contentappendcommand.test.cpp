@@ -0,0 +1,48 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <mvvm/commands/contentappendcommand.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data1ditem.h>
+
+using namespace ModelView;
+
+class ContentAppendCommandTest : public ::testing::Test
+{
+public:
+    ~ContentAppendCommandTest();
+};
+
+ContentAppendCommandTest::~ContentAppendCommandTest() = default;
+
+//! Append values through ContentAppendCommand command.
+
+TEST_F(ContentAppendCommandTest, appendContent)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+
+    std::vector<double> values{3.0, 4.0};
+    auto command = std::make_unique<ContentAppendCommand>(item, values);
+
+    // executing command
+    command->execute();
+    EXPECT_TRUE(command->result());
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0, 3.0, 4.0}));
+    EXPECT_EQ(item->binCenters(), std::vector<double>({0.5, 1.5, 2.5, 3.5}));
+
+    // undoing command
+    command->undo();
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(item->binCenters(), std::vector<double>({0.5, 1.5}));
+}
@@ -0,0 +1,66 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <mvvm/commands/contentregioncommand.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/numericarray.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data2ditem.h>
+
+using namespace ModelView;
+
+class ContentRegionCommandTest : public ::testing::Test
+{
+public:
+    ~ContentRegionCommandTest();
+};
+
+ContentRegionCommandTest::~ContentRegionCommandTest() = default;
+
+//! Set values of the region through ContentRegionCommand command.
+
+TEST_F(ContentRegionCommandTest, setContentRegion)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(2, 0.0, 2.0));
+    item->setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+
+    Data2DItem::Region region{1, 0, 1, 2};
+    std::vector<double> values{20.0, 40.0};
+    auto command = std::make_unique<ContentRegionCommand>(item, region, values);
+
+    // executing command
+    command->execute();
+    EXPECT_TRUE(command->result());
+    EXPECT_EQ(item->content(), std::vector<double>({1.0, 20.0, 3.0, 40.0}));
+
+    // undoing command
+    command->undo();
+    EXPECT_EQ(item->content(), std::vector<double>({1.0, 2.0, 3.0, 4.0}));
+}
+
+//! Setting values of the region through the model without undo stack.
+
+TEST_F(ContentRegionCommandTest, setContentRegionViaModel)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+
+    model.setContentRegion(item, 0, 0, 2, 1, {1.0, 2.0});
+    EXPECT_EQ(model.undoStack(), nullptr);
+    EXPECT_EQ(item->content(), std::vector<double>({1.0, 2.0}));
+
+    // content doesn't match the axes
+    item->setData(QVariant::fromValue(NumericArray(std::vector<double>{1.0})));
+    EXPECT_THROW(model.setContentRegion(item, 0, 0, 1, 1, {1.0}), std::runtime_error);
+}
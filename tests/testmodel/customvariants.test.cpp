@@ -85,6 +85,11 @@ TEST_F(CustomVariantsTest, CompatibleVariantTypes)
             }
         }
     }
+
+    // vector of doubles can be upgraded to NumericArray, but not the opposite
+    QVariant array_variant = QVariant::fromValue(NumericArray(vec));
+    EXPECT_TRUE(Utils::CompatibleVariantTypes(vector_variant, array_variant));
+    EXPECT_FALSE(Utils::CompatibleVariantTypes(array_variant, vector_variant));
 }
 
 //! Test variant equality reported by SessionItemUtils::isTheSame
@@ -155,6 +160,22 @@ TEST_F(CustomVariantsTest, IsTheSameComboProperty)
     EXPECT_FALSE(Utils::IsTheSame(v1, v2));
 }
 
+//! NumericArray based variants are the same only if they share the buffer.
+
+TEST_F(CustomVariantsTest, IsTheSameNumericArray)
+{
+    NumericArray array1(std::vector<float>{1.0f, 2.0f});
+    NumericArray array2 = array1;
+    NumericArray array3(std::vector<float>{1.0f, 2.0f});
+
+    EXPECT_TRUE(Utils::IsNumericArrayVariant(QVariant::fromValue(array1)));
+    EXPECT_TRUE(Utils::IsTheSame(QVariant::fromValue(array1), QVariant::fromValue(array2)));
+    EXPECT_FALSE(Utils::IsTheSame(QVariant::fromValue(array1), QVariant::fromValue(array3)));
+
+    array2.mutableValues<float>()[0] = 3.0f;
+    EXPECT_FALSE(Utils::IsTheSame(QVariant::fromValue(array1), QVariant::fromValue(array2)));
+}
+
 //! Test translation of variants
 
 TEST_F(CustomVariantsTest, variantTranslation)
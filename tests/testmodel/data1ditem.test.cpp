@@ -9,7 +9,11 @@
 
 #include "MockWidgets.h"
 #include "google_test.h"
+#include <QUndoStack>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/numericarray.h>
 #include <mvvm/model/sessionmodel.h>
+#include <mvvm/signals/modelmapper.h>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/data1ditem.h>
 
@@ -62,6 +66,20 @@ TEST_F(Data1DItemTest, setFixedBinAxis)
     EXPECT_EQ(item.binValues(), expected_values);
 }
 
+//! Checking the method ::setAxis with variable bin axis.
+
+TEST_F(Data1DItemTest, setVariableBinAxis)
+{
+    Data1DItem item;
+    item.setAxis(VariableBinAxisItem::create({0.0, 1.0, 3.0}));
+
+    EXPECT_EQ(item.binCenters(), std::vector<double>({0.5, 2.0}));
+    EXPECT_EQ(item.binValues(), std::vector<double>({0.0, 0.0}));
+
+    // appending requires fixed bin axis
+    EXPECT_THROW(item.appendContent({1.0}), std::runtime_error);
+}
+
 //! Checking the method ::setContent.
 
 TEST_F(Data1DItemTest, setContent)
@@ -77,6 +95,30 @@ TEST_F(Data1DItemTest, setContent)
     EXPECT_EQ(item.binValues(), expected_content);
 }
 
+//! Checking the method ::setContent with moved data, and access to values by reference.
+
+TEST_F(Data1DItemTest, moveContent)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data1DItem>();
+    EXPECT_TRUE(item->binValuesRef().empty());
+
+    item->setAxis(FixedBinAxisItem::create(3, 0.0, 3.0));
+    EXPECT_EQ(item->binValuesRef(), std::vector<double>({0.0, 0.0, 0.0}));
+
+    std::vector<double> content = {1.0, 2.0, 3.0};
+    const auto expected_content = content;
+    const double* buffer = content.data();
+    item->setContent(std::move(content));
+
+    EXPECT_EQ(item->binValuesRef(), expected_content);
+    EXPECT_EQ(item->binValuesRef().data(), buffer); // buffer wasn't copied
+    EXPECT_EQ(item->binValues(), expected_content);
+
+    std::vector<double> wrong_content = {1.0, 2.0};
+    EXPECT_THROW(item->setContent(std::move(wrong_content)), std::runtime_error);
+}
+
 //! Checking the signals when axes changed.
 
 TEST_F(Data1DItemTest, checkSignalsOnAxisChange)
@@ -116,3 +158,266 @@ TEST_F(Data1DItemTest, checkSignalsOnContentChange)
     // trigger change
     item->setContent(std::vector<double>{1.0, 2.0, 3.0});
 }
+
+//! Content is stored as NumericArray, content saved by older versions as vector of doubles is
+//! converted on the first modification.
+
+TEST_F(Data1DItemTest, numericArrayStorage)
+{
+    Data1DItem item;
+    item.setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    std::vector<double> values{1.0, 2.0};
+    const double* buffer = values.data();
+    item.setContent(std::move(values));
+    EXPECT_EQ(item.data().value<NumericArray>().values<double>().data(), buffer);
+    EXPECT_EQ(item.binValuesRef().data(), buffer);
+
+    Data1DItem legacy;
+    legacy.setData(QVariant::fromValue(std::vector<double>{1.0, 2.0}));
+    legacy.insertItem(FixedBinAxisItem::create(2, 0.0, 2.0).release(), {Data1DItem::T_AXIS, 0});
+    EXPECT_EQ(legacy.binValues(), std::vector<double>({1.0, 2.0}));
+
+    legacy.appendContent({3.0});
+    EXPECT_TRUE(Utils::IsNumericArrayVariant(legacy.data()));
+    EXPECT_EQ(legacy.binValues(), std::vector<double>({1.0, 2.0, 3.0}));
+}
+
+//! Content of float32 and int32 numbers is read as converted to float64, and is replaced by float64
+//! numbers on the first modification.
+
+TEST_F(Data1DItemTest, float32Content)
+{
+    Data1DItem item;
+    item.setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    item.setData(QVariant::fromValue(NumericArray(std::vector<float>{1.0f, -2.0f})));
+    EXPECT_EQ(item.binValuesRef(), std::vector<double>({1.0, -2.0}));
+    EXPECT_EQ(item.binValuesRef().data(), item.binValuesRef().data()); // converted once
+    EXPECT_EQ(item.valueRange(), std::make_pair(-2.0, 1.0));
+
+    item.appendContent({3.0});
+    EXPECT_EQ(item.data().value<NumericArray>().elementType(), NumericArray::ElementType::FLOAT64);
+    EXPECT_EQ(item.binValues(), std::vector<double>({1.0, -2.0, 3.0}));
+    EXPECT_EQ(item.valueRange(), std::make_pair(-2.0, 3.0));
+
+    item.setData(QVariant::fromValue(NumericArray(std::vector<int32_t>{1, 2})));
+    EXPECT_THROW(item.appendContent({3.0}), std::runtime_error);
+    item.updateContent([](std::vector<double>& values) { values[0] = 0.5; });
+    EXPECT_EQ(item.binValues(), std::vector<double>({0.5, 2.0}));
+}
+
+//! Checking the method ::appendContent.
+
+TEST_F(Data1DItemTest, appendContent)
+{
+    Data1DItem item;
+    EXPECT_THROW(item.appendContent({1.0}), std::runtime_error);
+
+    item.setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    item.setContent(std::vector<double>{1.0, 2.0});
+
+    item.appendContent({3.0, 4.0});
+    EXPECT_EQ(item.binValues(), std::vector<double>({1.0, 2.0, 3.0, 4.0}));
+    EXPECT_EQ(item.binCenters(), std::vector<double>({0.5, 1.5, 2.5, 3.5}));
+    EXPECT_EQ(item.appendedCount(), 0);
+
+    // appending to the axis without bins
+    Data1DItem item2;
+    item2.setAxis(FixedBinAxisItem::create(0, 0.0, 1.0));
+    item2.appendContent({1.0});
+    item2.appendContent({2.0});
+    EXPECT_EQ(item2.binValues(), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(item2.binCenters(), std::vector<double>({0.5, 1.5}));
+}
+
+//! Checking the signals when content is appended.
+
+TEST_F(Data1DItemTest, checkSignalsOnAppendContent)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(3, 0.0, 3.0));
+
+    int appended_count{0};
+    std::vector<double> values;
+    auto on_data_change = [&appended_count, &values](SessionItem* item, int) {
+        auto data_item = static_cast<Data1DItem*>(item);
+        appended_count = data_item->appendedCount();
+        values = data_item->binValues();
+    };
+    item->mapper()->setOnDataChange(on_data_change, this);
+
+    item->appendContent({1.0, 2.0});
+    EXPECT_EQ(appended_count, 2);
+    EXPECT_EQ(values, std::vector<double>({0.0, 0.0, 0.0, 1.0, 2.0}));
+
+    item->setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0});
+    EXPECT_EQ(appended_count, 0);
+}
+
+//! Appended values extend the content buffer in place. Undo/redo and subscribers reading the data
+//! during notifications don't keep copies of the buffer, so it isn't copied on append.
+
+TEST_F(Data1DItemTest, appendContentInPlace)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(100, 0.0, 100.0));
+
+    double last_value{0.0};
+    auto on_data_change = [&last_value](SessionItem* item, int) {
+        last_value = item->data().value<NumericArray>().values<double>().back();
+    };
+    item->mapper()->setOnDataChange(on_data_change, this);
+
+    // first append reallocates the buffer with the reserve for following appends
+    item->appendContent({1.0});
+    const double* buffer = item->binValuesRef().data();
+    const size_t capacity = item->binValuesRef().capacity();
+    ASSERT_GT(capacity, 101u);
+
+    for (size_t i = item->binValuesRef().size(); i < capacity; ++i) {
+        item->appendContent({static_cast<double>(i)});
+        EXPECT_EQ(last_value, static_cast<double>(i));
+        EXPECT_EQ(item->binValuesRef().data(), buffer);
+    }
+    EXPECT_EQ(item->binValuesRef().size(), capacity);
+}
+
+//! Undo/redo of appended content.
+
+TEST_F(Data1DItemTest, undoAppendContent)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+
+    auto stack = model.undoStack();
+    const int index = stack->index();
+
+    item->appendContent({3.0});
+    EXPECT_EQ(stack->index(), index + 1);
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0, 3.0}));
+
+    stack->undo();
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(item->binCenters(), std::vector<double>({0.5, 1.5}));
+
+    stack->redo();
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(item->binCenters(), std::vector<double>({0.5, 1.5, 2.5}));
+
+    // undo restores the range of the axis without bins
+    auto item2 = model.insertItem<Data1DItem>();
+    item2->setAxis(FixedBinAxisItem::create(0, 0.0, 5.0));
+    item2->appendContent({1.0});
+    EXPECT_EQ(item2->binCenters(), std::vector<double>({2.5}));
+    stack->undo();
+    EXPECT_EQ(item2->item<BinnedAxisItem>(Data1DItem::T_AXIS)->range(), std::make_pair(0.0, 5.0));
+}
+
+//! Every data change notification during append and its undo/redo sees the number of bins
+//! matching the number of values.
+
+TEST_F(Data1DItemTest, consistentNotificationsOnAppendContent)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+
+    int notification_count{0};
+    bool is_consistent{true};
+    auto on_data_change = [item, &notification_count, &is_consistent](SessionItem*, int) {
+        ++notification_count;
+        auto axis = item->item<BinnedAxisItem>(Data1DItem::T_AXIS);
+        is_consistent &= static_cast<size_t>(axis->size()) == item->binValuesRef().size();
+    };
+    model.mapper()->setOnDataChange(on_data_change, this);
+
+    // content, number of bins and upper limit of the axis are notified
+    item->appendContent({1.0, 2.0});
+    EXPECT_EQ(notification_count, 3);
+
+    model.undoStack()->undo();
+    EXPECT_EQ(item->binCenters(), std::vector<double>({0.5, 1.5}));
+    model.undoStack()->redo();
+    EXPECT_EQ(notification_count, 9);
+    EXPECT_TRUE(is_consistent);
+
+    // same without undo stack
+    model.setUndoRedoEnabled(false);
+    item->appendContent({3.0});
+    EXPECT_EQ(notification_count, 12);
+    EXPECT_TRUE(is_consistent);
+}
+
+//! Cached range of values follows all content changes.
+
+TEST_F(Data1DItemTest, valueRange)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<Data1DItem>();
+    EXPECT_EQ(item->valueRange(), std::make_pair(0.0, 0.0));
+
+    item->setAxis(FixedBinAxisItem::create(3, 0.0, 3.0));
+    item->setContent(std::vector<double>{2.0, -1.0, 3.0});
+    EXPECT_EQ(item->valueRange(), std::make_pair(-1.0, 3.0));
+
+    // range is extended on append already during the notification
+    std::pair<double, double> notified_range;
+    auto on_data_change = [&notified_range](SessionItem* item, int) {
+        notified_range = static_cast<Data1DItem*>(item)->valueRange();
+    };
+    item->mapper()->setOnDataChange(on_data_change, this);
+
+    item->appendContent({10.0, -5.0});
+    EXPECT_EQ(notified_range, std::make_pair(-5.0, 10.0));
+    EXPECT_EQ(item->valueRange(), std::make_pair(-5.0, 10.0));
+
+    model.undoStack()->undo();
+    EXPECT_EQ(item->valueRange(), std::make_pair(-1.0, 3.0));
+
+    item->setContent(std::vector<double>{4.0, 5.0, 6.0});
+    EXPECT_EQ(item->valueRange(), std::make_pair(4.0, 6.0));
+}
+
+//! In-place modification of the content.
+
+TEST_F(Data1DItemTest, updateContent)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(3, 0.0, 3.0));
+    item->setContent(std::vector<double>{1.0, 2.0, 3.0});
+    EXPECT_EQ(item->valueRange(), std::make_pair(1.0, 3.0));
+
+    int notification_count{0};
+    auto on_data_change = [&notification_count](SessionItem*, int) { ++notification_count; };
+    item->mapper()->setOnDataChange(on_data_change, this);
+
+    item->updateContent([](std::vector<double>& values) { values[1] = 10.0; });
+    EXPECT_EQ(notification_count, 1);
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 10.0, 3.0}));
+    EXPECT_EQ(item->valueRange(), std::make_pair(1.0, 10.0));
+}
+
+//! In-place modification of the content with undo/redo enabled.
+
+TEST_F(Data1DItemTest, undoUpdateContent)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+
+    item->updateContent([](std::vector<double>& values) { values[0] = 5.0; });
+    EXPECT_EQ(item->binValues(), std::vector<double>({5.0, 2.0}));
+
+    model.undoStack()->undo();
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0}));
+}
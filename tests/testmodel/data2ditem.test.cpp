@@ -9,6 +9,9 @@
 
 #include "MockWidgets.h"
 #include "google_test.h"
+#include <QUndoStack>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/numericarray.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/standarditems/axisitems.h>
 #include <mvvm/standarditems/data2ditem.h>
@@ -73,6 +76,30 @@ TEST_F(Data2DItemTest, setContent)
     EXPECT_EQ(item.content(), expected_content);
 }
 
+//! Checking the method ::setContent with moved data, and access to content by reference.
+
+TEST_F(Data2DItemTest, moveContent)
+{
+    Data2DItem item;
+    EXPECT_TRUE(item.contentRef().empty());
+
+    const int nx = 2, ny = 2;
+    item.setAxes(FixedBinAxisItem::create(nx, 0.0, 5.0), FixedBinAxisItem::create(ny, 0.0, 3.0));
+
+    std::vector<double> content = {1.0, 2.0, 3.0, 4.0};
+    const auto expected_content = content;
+    const double* buffer = content.data();
+    item.setContent(std::move(content));
+
+    EXPECT_EQ(item.contentRef(), expected_content);
+    EXPECT_EQ(item.contentRef().data(), buffer); // buffer wasn't copied
+    EXPECT_EQ(item.contentRef().data(), item.contentRef().data());
+    EXPECT_EQ(item.content(), expected_content);
+
+    std::vector<double> wrong_content = {1.0, 2.0};
+    EXPECT_THROW(item.setContent(std::move(wrong_content)), std::runtime_error);
+}
+
 //! Checking the signals when axes changed.
 
 TEST_F(Data2DItemTest, checkSignalsOnAxisChange)
@@ -113,3 +140,133 @@ TEST_F(Data2DItemTest, checkSignalsOnContentChange)
     // trigger change
     item->setContent(std::vector<double>{1.0, 2.0, 3.0});
 }
+
+//! Checking the method ::setContentRegion.
+
+TEST_F(Data2DItemTest, setContentRegion)
+{
+    Data2DItem item;
+    EXPECT_THROW(item.setContentRegion(0, 0, 1, 1, {1.0}), std::runtime_error);
+
+    const int nx = 3, ny = 2;
+    item.setAxes(FixedBinAxisItem::create(nx, 0.0, 3.0), FixedBinAxisItem::create(ny, 0.0, 2.0));
+    item.setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+
+    // region outside of axes, or data not matching the region
+    EXPECT_THROW(item.setContentRegion(2, 0, 2, 1, {1.0, 2.0}), std::runtime_error);
+    EXPECT_THROW(item.setContentRegion(0, 1, 1, 2, {1.0, 2.0}), std::runtime_error);
+    EXPECT_THROW(item.setContentRegion(0, 0, 2, 2, {1.0, 2.0}), std::runtime_error);
+
+    item.setContentRegion(1, 0, 2, 2, {20.0, 30.0, 50.0, 60.0});
+    EXPECT_EQ(item.content(), std::vector<double>({1.0, 20.0, 30.0, 4.0, 50.0, 60.0}));
+
+    // outside of notification the whole content is reported as changed
+    auto region = item.changedRegion();
+    EXPECT_EQ(region.x, 0);
+    EXPECT_EQ(region.y, 0);
+    EXPECT_EQ(region.width, nx);
+    EXPECT_EQ(region.height, ny);
+
+    // content not matching the axes
+    item.setData(QVariant::fromValue(NumericArray(std::vector<double>{1.0, 2.0})));
+    EXPECT_THROW(item.setContentRegion(0, 0, 1, 1, {1.0}), std::runtime_error);
+}
+
+//! Content of float32 numbers is read as converted to float64, and is replaced by float64 numbers
+//! on the first modification.
+
+TEST_F(Data2DItemTest, float32Content)
+{
+    Data2DItem item;
+    item.setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+    item.setData(QVariant::fromValue(NumericArray(std::vector<float>{1.0f, -2.0f})));
+    EXPECT_EQ(item.contentRef(), std::vector<double>({1.0, -2.0}));
+    EXPECT_EQ(item.contentRange(), std::make_pair(-2.0, 1.0));
+
+    item.setContentRegion(1, 0, 1, 1, {4.0});
+    EXPECT_EQ(item.data().value<NumericArray>().elementType(), NumericArray::ElementType::FLOAT64);
+    EXPECT_EQ(item.content(), std::vector<double>({1.0, 4.0}));
+    EXPECT_EQ(item.contentRange(), std::make_pair(1.0, 4.0));
+}
+
+//! Checking the signals when content region changed.
+
+TEST_F(Data2DItemTest, checkSignalsOnContentRegionChange)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(3, 0.0, 3.0), FixedBinAxisItem::create(2, 0.0, 2.0));
+
+    Data2DItem::Region region;
+    auto on_data_change = [&region](SessionItem* item, int) {
+        region = static_cast<Data2DItem*>(item)->changedRegion();
+    };
+    item->mapper()->setOnDataChange(on_data_change, this);
+
+    item->setContentRegion(1, 1, 2, 1, {1.0, 2.0});
+    EXPECT_EQ(region.x, 1);
+    EXPECT_EQ(region.y, 1);
+    EXPECT_EQ(region.width, 2);
+    EXPECT_EQ(region.height, 1);
+}
+
+//! Undo/redo of content region change.
+
+TEST_F(Data2DItemTest, undoContentRegion)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(2, 0.0, 2.0));
+    item->setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+
+    auto stack = model.undoStack();
+    const int index = stack->index();
+
+    item->setContentRegion(0, 1, 2, 1, {30.0, 40.0});
+    EXPECT_EQ(stack->index(), index + 1);
+    EXPECT_EQ(item->content(), std::vector<double>({1.0, 2.0, 30.0, 40.0}));
+
+    stack->undo();
+    EXPECT_EQ(item->content(), std::vector<double>({1.0, 2.0, 3.0, 4.0}));
+
+    stack->redo();
+    EXPECT_EQ(item->content(), std::vector<double>({1.0, 2.0, 30.0, 40.0}));
+}
+
+//! Cached range of content follows all content changes.
+
+TEST_F(Data2DItemTest, contentRange)
+{
+    Data2DItem item;
+    EXPECT_EQ(item.contentRange(), std::make_pair(0.0, 0.0));
+
+    item.setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(2, 0.0, 2.0));
+    item.setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+    EXPECT_EQ(item.contentRange(), std::make_pair(1.0, 4.0));
+
+    item.setContentRegion(1, 1, 1, 1, {0.5});
+    EXPECT_EQ(item.contentRange(), std::make_pair(0.5, 3.0));
+
+    item.setContent(std::vector<double>{5.0, 6.0, 7.0, 8.0});
+    EXPECT_EQ(item.contentRange(), std::make_pair(5.0, 8.0));
+}
+
+//! In-place modification of the content.
+
+TEST_F(Data2DItemTest, updateContent)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+
+    int notification_count{0};
+    auto on_data_change = [&notification_count](SessionItem*, int) { ++notification_count; };
+    item->mapper()->setOnDataChange(on_data_change, this);
+
+    item->updateContent([](std::vector<double>& values) { values[0] = -1.0; });
+    EXPECT_EQ(notification_count, 1);
+    EXPECT_EQ(item->content(), std::vector<double>({-1.0, 2.0}));
+    EXPECT_EQ(item->contentRange(), std::make_pair(-1.0, 2.0));
+}
@@ -0,0 +1,126 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/itemfactory.h>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/serialization/directitemcopystrategy.h>
+#include <mvvm/standarditems/standarditemcatalogue.h>
+#include <vector>
+
+using namespace ModelView;
+
+class DirectItemCopyStrategyTest : public ::testing::Test
+{
+public:
+    DirectItemCopyStrategyTest()
+        : m_factory(std::make_unique<ItemFactory>(CreateStandardItemCatalogue()))
+    {
+    }
+    ~DirectItemCopyStrategyTest();
+
+    std::unique_ptr<DirectItemCopyStrategy> createCopyStrategy()
+    {
+        return std::make_unique<DirectItemCopyStrategy>(m_factory.get());
+    }
+
+    std::unique_ptr<ItemFactory> m_factory;
+};
+
+DirectItemCopyStrategyTest::~DirectItemCopyStrategyTest() = default;
+
+//! Saving/restoring PropertyItem.
+
+TEST_F(DirectItemCopyStrategyTest, propertyItem)
+{
+    auto strategy = createCopyStrategy();
+
+    PropertyItem item;
+    item.setData(42.0);
+
+    auto copy = strategy->createCopy(&item);
+
+    EXPECT_EQ(item.modelType(), copy->modelType());
+    EXPECT_EQ(item.data(), copy->data());
+    EXPECT_FALSE(item.identifier() == copy->identifier());
+}
+
+//! Saving/restoring CompoundItem.
+
+TEST_F(DirectItemCopyStrategyTest, compoundItem)
+{
+    auto strategy = createCopyStrategy();
+
+    CompoundItem item;
+    auto property = item.addProperty("thickness", 42.0);
+
+    auto copy = strategy->createCopy(&item);
+
+    EXPECT_EQ(item.modelType(), copy->modelType());
+    EXPECT_EQ(copy->getItem("thickness")->data(), property->data());
+    EXPECT_FALSE(copy->getItem("thickness")->identifier() == property->identifier());
+    EXPECT_FALSE(item.identifier() == copy->identifier());
+}
+
+//! Saving/restoring CustomItem.
+
+TEST_F(DirectItemCopyStrategyTest, customItem)
+{
+    auto strategy = createCopyStrategy();
+
+    const std::string model_type(Constants::BaseType);
+
+    // creating parent with one child
+    auto parent = std::make_unique<SessionItem>(model_type);
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child = new SessionItem(model_type);
+    child->setDisplayName("child_name");
+    parent->insertItem(child, TagRow::append());
+
+    // creating copy
+    auto parent_copy = strategy->createCopy(parent.get());
+
+    EXPECT_EQ(parent_copy->childrenCount(), 1);
+    EXPECT_EQ(parent_copy->modelType(), model_type);
+    EXPECT_EQ(parent_copy->displayName(), "parent_name");
+    EXPECT_EQ(parent_copy->defaultTag(), "defaultTag");
+    EXPECT_EQ(parent_copy->model(), nullptr);
+    EXPECT_FALSE(parent_copy->identifier() == parent->identifier());
+
+    // checking child reconstruction
+    auto child_copy = parent_copy->getItem("defaultTag");
+    EXPECT_EQ(child_copy->parent(), parent_copy.get());
+    EXPECT_EQ(child_copy->childrenCount(), 0);
+    EXPECT_EQ(child_copy->modelType(), model_type);
+    EXPECT_EQ(child_copy->displayName(), "child_name");
+    EXPECT_EQ(child_copy->defaultTag(), "");
+    EXPECT_FALSE(child_copy->identifier() == child->identifier());
+}
+
+//! Creating exact clone of CompoundItem, with same identifiers.
+
+TEST_F(DirectItemCopyStrategyTest, exactClone)
+{
+    DirectItemCopyStrategy strategy(m_factory.get(), /*new_id_flag*/ false);
+
+    CompoundItem item;
+    auto property = item.addProperty("thickness", 42.0);
+    auto vector_property = item.addProperty("values", std::vector<double>{1.0, 2.0});
+
+    auto copy = strategy.createCopy(&item);
+
+    EXPECT_EQ(item.modelType(), copy->modelType());
+    EXPECT_EQ(item.identifier(), copy->identifier());
+    EXPECT_EQ(copy->getItem("thickness")->identifier(), property->identifier());
+    EXPECT_EQ(copy->getItem("thickness")->data(), property->data());
+    EXPECT_EQ(copy->getItem("values")->data(), vector_property->data());
+    EXPECT_EQ(copy->getItem("thickness")->parent(), copy.get());
+}
@@ -0,0 +1,270 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include "test_utils.h"
+#include <QFile>
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/model/taginfo.h>
+#include <mvvm/serialization/incrementaljsondocument.h>
+
+using namespace ModelView;
+
+//! Tests IncrementalJsonDocument class
+
+class IncrementalJsonDocumentTest : public ::testing::Test
+{
+public:
+    ~IncrementalJsonDocumentTest();
+
+    static const QString test_dir;
+
+    static void SetUpTestCase() { TestUtils::CreateTestDirectory(test_dir); }
+
+    //! Returns name of the file in test directory, removes existing snapshot and journal.
+    static std::string cleanFileName(const QString& name)
+    {
+        auto result = TestUtils::TestFileName(test_dir, name).toStdString();
+        QFile::remove(QString::fromStdString(result));
+        QFile::remove(QString::fromStdString(IncrementalJsonDocument::journalName(result)));
+        return result;
+    }
+
+    static bool exists(const std::string& file_name)
+    {
+        return QFile::exists(QString::fromStdString(file_name));
+    }
+};
+
+IncrementalJsonDocumentTest::~IncrementalJsonDocumentTest() = default;
+const QString IncrementalJsonDocumentTest::test_dir = "test_IncrementalJsonDocument";
+
+//! Initial state of the document.
+
+TEST_F(IncrementalJsonDocumentTest, initialState)
+{
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+    EXPECT_FALSE(document.isModified());
+
+    model.insertItem<SessionItem>();
+    EXPECT_TRUE(document.isModified());
+}
+
+//! First increment, when there is no snapshot yet, leads to the full save.
+
+TEST_F(IncrementalJsonDocumentTest, firstIncrement)
+{
+    auto fileName = cleanFileName("first.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    model.insertItem<PropertyItem>()->setData(42.0);
+    document.saveIncrement(fileName);
+
+    EXPECT_TRUE(exists(fileName));
+    EXPECT_FALSE(exists(IncrementalJsonDocument::journalName(fileName)));
+    EXPECT_FALSE(document.isModified());
+}
+
+//! Data change is appended to the journal and restored on load.
+
+TEST_F(IncrementalJsonDocumentTest, dataChange)
+{
+    auto fileName = cleanFileName("datachange.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    auto compound = model.insertItem<CompoundItem>();
+    auto property = compound->addProperty("thickness", 42.0);
+    for (int i = 0; i < 10; ++i)
+        compound->addProperty("property" + std::to_string(i), i);
+    document.save(fileName);
+
+    property->setData(43.0);
+    document.saveIncrement(fileName);
+    EXPECT_TRUE(exists(IncrementalJsonDocument::journalName(fileName)));
+    const auto expected = TestUtils::ModelToJsonString(model);
+
+    SessionModel reco_model("TestModel");
+    IncrementalJsonDocument reco_document({&reco_model});
+    reco_document.load(fileName);
+
+    EXPECT_EQ(reco_model.rootItem()->getItem("")->getItem("thickness")->data(), 43.0);
+    EXPECT_EQ(TestUtils::ModelToJsonString(reco_model), expected);
+    EXPECT_FALSE(reco_document.isModified());
+}
+
+//! Insertion and removal of items in several increments.
+
+TEST_F(IncrementalJsonDocumentTest, structureChange)
+{
+    auto fileName = cleanFileName("structurechange.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child0 = model.insertItem<PropertyItem>(parent);
+    model.insertItem<PropertyItem>(parent);
+    model.insertItem<SessionItem>();
+    document.save(fileName);
+
+    // first increment
+    model.insertItem<PropertyItem>(parent, {"", 1})->setData(1.0);
+    child0->setData(2.0);
+    document.saveIncrement(fileName);
+
+    // second increment
+    model.removeItem(parent, {"", 2});
+    model.rootItem()->getItem("", 1)->setDisplayName("abc");
+    document.saveIncrement(fileName);
+
+    SessionModel reco_model("TestModel");
+    IncrementalJsonDocument reco_document({&reco_model});
+    reco_document.load(fileName);
+
+    EXPECT_EQ(reco_model.rootItem()->getItem("", 0)->childrenCount(), 2);
+    EXPECT_EQ(TestUtils::ModelToJsonString(reco_model), TestUtils::ModelToJsonString(model));
+}
+
+//! Insertion and removal of top level items is recorded for these items only.
+
+TEST_F(IncrementalJsonDocumentTest, topLevelStructureChange)
+{
+    auto fileName = cleanFileName("toplevelchange.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    model.insertItem<PropertyItem>()->setData(1.0);
+    model.insertItem<PropertyItem>()->setData(2.0);
+    auto compound = model.insertItem<CompoundItem>();
+    for (int i = 0; i < 10; ++i)
+        compound->addProperty("property" + std::to_string(i), i);
+    document.save(fileName);
+
+    auto item = model.insertItem<PropertyItem>();
+    model.insertItem<PropertyItem>(model.rootItem(), {"", 0})->setData(3.0);
+    model.removeItem(model.rootItem(), {"", 1});
+    model.insertItem<PropertyItem>(model.rootItem(), {"", 1});
+    model.removeItem(model.rootItem(), {"", 1});
+    item->setData(4.0);
+    document.saveIncrement(fileName);
+
+    // whole model wasn't written to the journal
+    QFile journal(QString::fromStdString(IncrementalJsonDocument::journalName(fileName)));
+    ASSERT_TRUE(journal.open(QIODevice::ReadOnly));
+    EXPECT_FALSE(journal.readAll().contains("\"type\":\"model\""));
+
+    SessionModel reco_model("TestModel");
+    IncrementalJsonDocument reco_document({&reco_model});
+    reco_document.load(fileName);
+
+    EXPECT_EQ(reco_model.rootItem()->childrenCount(), 4);
+    EXPECT_EQ(TestUtils::ModelToJsonString(reco_model), TestUtils::ModelToJsonString(model));
+}
+
+//! Increment which wasn't completely written is ignored on load.
+
+TEST_F(IncrementalJsonDocumentTest, brokenIncrement)
+{
+    auto fileName = cleanFileName("brokenincrement.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    auto compound = model.insertItem<CompoundItem>();
+    auto property = compound->addProperty("thickness", 42.0);
+    for (int i = 0; i < 10; ++i)
+        compound->addProperty("property" + std::to_string(i), i);
+    document.save(fileName);
+
+    property->setData(43.0);
+    document.saveIncrement(fileName);
+
+    // emulating crash during writing of the second increment
+    QFile journal(QString::fromStdString(IncrementalJsonDocument::journalName(fileName)));
+    ASSERT_TRUE(journal.open(QIODevice::Append));
+    journal.write("[{\"content\":");
+    journal.close();
+
+    SessionModel reco_model("TestModel");
+    IncrementalJsonDocument reco_document({&reco_model});
+    reco_document.load(fileName);
+
+    EXPECT_EQ(reco_model.rootItem()->getItem("")->getItem("thickness")->data(), 43.0);
+}
+
+//! Increment saved after recovery from the crash is restored on the next load.
+
+TEST_F(IncrementalJsonDocumentTest, incrementAfterBrokenIncrement)
+{
+    auto fileName = cleanFileName("incrementafterbroken.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    auto compound = model.insertItem<CompoundItem>();
+    auto property = compound->addProperty("thickness", 42.0);
+    for (int i = 0; i < 10; ++i)
+        compound->addProperty("property" + std::to_string(i), i);
+    document.save(fileName);
+
+    property->setData(43.0);
+    document.saveIncrement(fileName);
+
+    // emulating crash during writing of the second increment
+    QFile journal(QString::fromStdString(IncrementalJsonDocument::journalName(fileName)));
+    ASSERT_TRUE(journal.open(QIODevice::Append));
+    journal.write("[{\"content\":");
+    journal.close();
+
+    // recovery, new increment is appended after the last complete one
+    SessionModel reco_model("TestModel");
+    IncrementalJsonDocument reco_document({&reco_model});
+    reco_document.load(fileName);
+    reco_model.rootItem()->getItem("")->getItem("thickness")->setData(44.0);
+    reco_document.saveIncrement(fileName);
+
+    SessionModel reco_model2("TestModel");
+    IncrementalJsonDocument reco_document2({&reco_model2});
+    reco_document2.load(fileName);
+
+    EXPECT_EQ(reco_model2.rootItem()->getItem("")->getItem("thickness")->data(), 44.0);
+}
+
+//! Full save discards the journal.
+
+TEST_F(IncrementalJsonDocumentTest, fullSaveAfterIncrement)
+{
+    auto fileName = cleanFileName("fullsave.json");
+    SessionModel model("TestModel");
+    IncrementalJsonDocument document({&model});
+
+    auto compound = model.insertItem<CompoundItem>();
+    auto property = compound->addProperty("thickness", 42.0);
+    for (int i = 0; i < 10; ++i)
+        compound->addProperty("property" + std::to_string(i), i);
+    document.save(fileName);
+
+    property->setData(43.0);
+    document.saveIncrement(fileName);
+    EXPECT_TRUE(exists(IncrementalJsonDocument::journalName(fileName)));
+
+    property->setData(44.0);
+    document.save(fileName);
+    EXPECT_FALSE(exists(IncrementalJsonDocument::journalName(fileName)));
+
+    SessionModel reco_model("TestModel");
+    IncrementalJsonDocument reco_document({&reco_model});
+    reco_document.load(fileName);
+
+    EXPECT_EQ(reco_model.rootItem()->getItem("")->getItem("thickness")->data(), 44.0);
+}
@@ -8,6 +8,8 @@
 // ************************************************************************** //
 
 #include "google_test.h"
+#include <QJsonObject>
+#include <QStringList>
 #include <limits>
 #include <mvvm/serialization/jsonutils.h>
 #include <mvvm/utils/reallimits.h>
@@ -43,3 +45,26 @@ TEST_F(JsonUtilsTest, CreateLimits)
     EXPECT_EQ(JsonUtils::CreateLimits("upperlimited", 0.0, 42.0), RealLimits::upperLimited(42.0));
     EXPECT_EQ(JsonUtils::CreateLimits("limited", -1.0, 2.0), RealLimits::limited(-1.0, 2.0));
 }
+
+TEST_F(JsonUtilsTest, HasExactKeys)
+{
+    const QStringList expected = {"a", "b"};
+
+    QJsonObject json;
+    EXPECT_FALSE(JsonUtils::HasExactKeys(json, expected));
+
+    json["b"] = 1;
+    EXPECT_FALSE(JsonUtils::HasExactKeys(json, expected));
+
+    // order of keys doesn't matter
+    json["a"] = 2;
+    EXPECT_TRUE(JsonUtils::HasExactKeys(json, expected));
+
+    // extra key is not allowed
+    json["c"] = 3;
+    EXPECT_FALSE(JsonUtils::HasExactKeys(json, expected));
+
+    // same number of keys but different names
+    json.remove("a");
+    EXPECT_FALSE(JsonUtils::HasExactKeys(json, expected));
+}
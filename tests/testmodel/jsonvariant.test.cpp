@@ -63,6 +63,32 @@ TEST_F(JsonVariantTest, invalidVariant)
     EXPECT_EQ(variant, reco_variant);
 }
 
+//! Validation of json object representing variant.
+
+TEST_F(JsonVariantTest, isVariant)
+{
+    JsonVariant converter;
+
+    auto object = converter.get_json(QVariant(42));
+    EXPECT_TRUE(converter.isVariant(object));
+
+    // extra key is not allowed
+    object["abc"] = 1;
+    EXPECT_FALSE(converter.isVariant(object));
+    EXPECT_THROW(converter.get_variant(object), std::runtime_error);
+
+    // empty object is not a variant
+    EXPECT_FALSE(converter.isVariant(QJsonObject()));
+}
+
+//! Variant of unsupported type can't be converted.
+
+TEST_F(JsonVariantTest, unsupportedVariant)
+{
+    JsonVariant converter;
+    EXPECT_THROW(converter.get_json(QVariant(42.0f)), std::runtime_error);
+}
+
 //! Bool QVariant conversion.
 
 TEST_F(JsonVariantTest, boolVariant)
@@ -175,6 +201,27 @@ TEST_F(JsonVariantTest, vectorOfDoubleVariant)
     EXPECT_EQ(variant, reco_variant);
 }
 
+//! QVariant(NumericArray) conversion.
+
+TEST_F(JsonVariantTest, numericArrayVariant)
+{
+    JsonVariant converter;
+
+    NumericArray float_array(std::vector<float>{0.5f, 1.25f});
+    auto object = converter.get_json(QVariant::fromValue(float_array));
+    EXPECT_TRUE(converter.isVariant(object));
+    auto reco_variant = converter.get_variant(object);
+    EXPECT_TRUE(Utils::IsNumericArrayVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<NumericArray>(), float_array);
+
+    NumericArray int_array(std::vector<int32_t>{-1, 42});
+    EXPECT_EQ(ToJsonAndBack(QVariant::fromValue(int_array)).value<NumericArray>(), int_array);
+
+    NumericArray double_array(std::vector<double>{0.1, 1e-300});
+    EXPECT_EQ(ToJsonAndBack(QVariant::fromValue(double_array)).value<NumericArray>(),
+              double_array);
+}
+
 //! QVariant(ComboProperty) conversion.
 
 TEST_F(JsonVariantTest, comboPropertyVariant)
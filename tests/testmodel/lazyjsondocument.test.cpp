@@ -0,0 +1,281 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include "test_utils.h"
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/jsondocument.h>
+#include <mvvm/serialization/jsonitemconverter.h>
+#include <mvvm/serialization/lazyjsondocument.h>
+
+using namespace ModelView;
+
+//! Tests LazyJsonDocument class
+
+class LazyJsonDocumentTest : public ::testing::Test
+{
+public:
+    ~LazyJsonDocumentTest();
+
+    static const QString test_dir;
+
+    static void SetUpTestCase() { TestUtils::CreateTestDirectory(test_dir); }
+
+    static std::string fileName(const QString& name)
+    {
+        return TestUtils::TestFileName(test_dir, name).toStdString();
+    }
+
+    //! Populates model with compound items, each with a set of properties.
+    static void populate(SessionModel& model, int n_items)
+    {
+        for (int i = 0; i < n_items; ++i) {
+            auto compound = model.insertItem<CompoundItem>();
+            compound->setDisplayName("compound" + std::to_string(i));
+            compound->addProperty("thickness", 42.0 + i);
+            compound->addProperty("name", "abc");
+        }
+    }
+};
+
+LazyJsonDocumentTest::~LazyJsonDocumentTest() = default;
+const QString LazyJsonDocumentTest::test_dir = "test_LazyJsonDocument";
+
+//! On load only placeholders of top-level items are created.
+
+TEST_F(LazyJsonDocumentTest, loadPlaceholders)
+{
+    auto file_name = fileName("placeholders.json");
+    SessionModel model("TestModel");
+    populate(model, 3);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    SessionModel reco_model("TestModel");
+    LazyJsonDocument reco_document({&reco_model});
+    reco_document.load(file_name);
+
+    ASSERT_EQ(reco_model.rootItem()->childrenCount(), 3);
+    for (int i = 0; i < 3; ++i) {
+        auto original = model.rootItem()->getItem("", i);
+        auto placeholder = reco_model.rootItem()->getItem("", i);
+        EXPECT_FALSE(reco_document.isFetched(placeholder));
+        EXPECT_EQ(placeholder->identifier(), original->identifier());
+        EXPECT_EQ(placeholder->displayName(), original->displayName());
+        EXPECT_EQ(placeholder->modelType(), original->modelType());
+    }
+
+    reco_document.fetchAll();
+    EXPECT_TRUE(reco_document.isFetched(reco_model.rootItem()->getItem("", 0)));
+    EXPECT_EQ(TestUtils::ModelToJsonString(reco_model), TestUtils::ModelToJsonString(model));
+}
+
+//! Lookup doesn't load the content, placeholders are read-only items without children.
+
+TEST_F(LazyJsonDocumentTest, findItemDoesntFetch)
+{
+    auto file_name = fileName("findItem.json");
+    SessionModel model("TestModel");
+    populate(model, 3);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    auto id0 = model.rootItem()->getItem("", 0)->identifier();
+    auto property_id0 = model.rootItem()->getItem("", 0)->getItem("thickness")->identifier();
+
+    SessionModel reco_model("TestModel");
+    LazyJsonDocument reco_document({&reco_model});
+    reco_document.load(file_name);
+
+    auto placeholder = reco_model.findItem(id0);
+    ASSERT_TRUE(placeholder != nullptr);
+    EXPECT_EQ(placeholder, reco_model.rootItem()->getItem("", 0));
+    EXPECT_FALSE(reco_document.isFetched(placeholder));
+    EXPECT_FALSE(placeholder->isEditable());
+    EXPECT_EQ(placeholder->childrenCount(), 0);
+    EXPECT_TRUE(reco_model.canFetchItem(placeholder));
+    EXPECT_TRUE(reco_model.findItem(property_id0) == nullptr);
+}
+
+//! Item is fetched on explicit request for its own identifier or for one of its descendants,
+//! or on SessionModel::fetchItem request.
+
+TEST_F(LazyJsonDocumentTest, fetchItem)
+{
+    auto file_name = fileName("fetchItem.json");
+    SessionModel model("TestModel");
+    populate(model, 3);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    auto property_id2 = model.rootItem()->getItem("", 2)->getItem("thickness")->identifier();
+
+    SessionModel reco_model("TestModel");
+    LazyJsonDocument reco_document({&reco_model});
+    reco_document.load(file_name);
+
+    reco_document.fetchItem(property_id2);
+    auto property2 = reco_model.findItem(property_id2);
+    ASSERT_TRUE(property2 != nullptr);
+    EXPECT_EQ(property2->data(), 44.0);
+    EXPECT_EQ(property2->parent(), reco_model.rootItem()->getItem("", 2));
+    EXPECT_TRUE(reco_document.isFetched(property2->parent()));
+    EXPECT_FALSE(reco_model.canFetchItem(property2->parent()));
+    EXPECT_FALSE(reco_document.isFetched(reco_model.rootItem()->getItem("", 1)));
+
+    reco_model.fetchItem(reco_model.rootItem()->getItem("", 0));
+    auto item0 = reco_model.rootItem()->getItem("", 0);
+    EXPECT_TRUE(reco_document.isFetched(item0));
+    EXPECT_EQ(item0->getItem("thickness")->data(), 42.0);
+    EXPECT_FALSE(reco_document.isFetched(reco_model.rootItem()->getItem("", 1)));
+}
+
+//! Without the index file the model is loaded completely.
+
+TEST_F(LazyJsonDocumentTest, missingIndex)
+{
+    auto file_name = fileName("missingIndex.json");
+    SessionModel model("TestModel");
+    populate(model, 2);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+    QFile::remove(QString::fromStdString(LazyJsonDocument::indexName(file_name)));
+
+    SessionModel reco_model("TestModel");
+    LazyJsonDocument reco_document({&reco_model});
+    reco_document.load(file_name);
+
+    EXPECT_TRUE(reco_document.isFetched(reco_model.rootItem()->getItem("", 0)));
+    EXPECT_EQ(TestUtils::ModelToJsonString(reco_model), TestUtils::ModelToJsonString(model));
+}
+
+//! Saving partially fetched models writes the complete content without fetching the rest.
+
+TEST_F(LazyJsonDocumentTest, saveAfterLazyLoad)
+{
+    auto file_name = fileName("saveAfterLazyLoad.json");
+    SessionModel model("TestModel");
+    populate(model, 3);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    SessionModel model2("TestModel");
+    LazyJsonDocument document2({&model2});
+    document2.load(file_name);
+    document2.fetchItem(model.rootItem()->getItem("", 1)->identifier());
+    model2.rootItem()->getItem("", 1)->setProperty("thickness", 1.0);
+    model.rootItem()->getItem("", 1)->setProperty("thickness", 1.0);
+    document2.save(file_name);
+    EXPECT_FALSE(document2.isFetched(model2.rootItem()->getItem("", 0)));
+
+    SessionModel model3("TestModel");
+    LazyJsonDocument document3({&model3});
+    document3.load(file_name);
+    document3.fetchAll();
+    EXPECT_EQ(TestUtils::ModelToJsonString(model3), TestUtils::ModelToJsonString(model));
+
+    // remaining placeholders are loaded from the new file
+    document2.fetchAll();
+    EXPECT_EQ(TestUtils::ModelToJsonString(model2), TestUtils::ModelToJsonString(model));
+}
+
+//! The index contains top-level items only.
+
+TEST_F(LazyJsonDocumentTest, indexOfTopLevelItems)
+{
+    auto file_name = fileName("index.json");
+    SessionModel model("TestModel");
+    populate(model, 2);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    QFile file(QString::fromStdString(LazyJsonDocument::indexName(file_name)));
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    auto models = QJsonDocument::fromJson(file.readAll()).object()["models"].toArray();
+    ASSERT_EQ(models.size(), 1);
+    auto items = models.at(0).toObject()["items"].toArray();
+    ASSERT_EQ(items.size(), 2);
+    auto entry = items.at(0).toObject();
+    EXPECT_EQ(entry.keys(), QStringList({"identifier", "name", "offset", "size", "type"}));
+    EXPECT_EQ(entry["identifier"].toString().toStdString(),
+              model.rootItem()->getItem("", 0)->identifier());
+}
+
+//! Main file can be read by the ordinary loader.
+
+TEST_F(LazyJsonDocumentTest, readableByJsonModelConverter)
+{
+    auto file_name = fileName("compatibility.json");
+    SessionModel model("TestModel");
+    populate(model, 2);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    QFile file(QString::fromStdString(file_name));
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    auto array = QJsonDocument::fromJson(file.readAll()).array();
+    ASSERT_EQ(array.size(), 1);
+    EXPECT_EQ(array.at(0).toObject()["model"].toString(), QString("TestModel"));
+}
+
+//! Placeholders can't be serialized or copied by other means, saving with JsonDocument loads all
+//! items first.
+
+TEST_F(LazyJsonDocumentTest, foreignSerialization)
+{
+    auto file_name = fileName("foreign.json");
+    SessionModel model("TestModel");
+    populate(model, 2);
+    LazyJsonDocument document({&model});
+    document.save(file_name);
+
+    SessionModel reco_model("TestModel");
+    LazyJsonDocument reco_document({&reco_model});
+    reco_document.load(file_name);
+    auto placeholder = reco_model.rootItem()->getItem("", 0);
+
+    JsonItemConverter converter(reco_model.factory());
+    EXPECT_THROW(converter.to_json(placeholder), std::runtime_error);
+    EXPECT_THROW(reco_model.copyItem(placeholder, reco_model.rootItem()), std::runtime_error);
+
+    auto foreign_name = fileName("foreign_copy.json");
+    JsonDocument json_document({&reco_model});
+    json_document.save(foreign_name);
+    EXPECT_TRUE(reco_document.isFetched(reco_model.rootItem()->getItem("", 0)));
+    EXPECT_TRUE(reco_document.isFetched(reco_model.rootItem()->getItem("", 1)));
+
+    SessionModel foreign_model("TestModel");
+    JsonDocument({&foreign_model}).load(foreign_name);
+    ASSERT_EQ(foreign_model.rootItem()->childrenCount(), 2);
+    auto item = foreign_model.rootItem()->getItem("", 1);
+    EXPECT_EQ(item->identifier(), model.rootItem()->getItem("", 1)->identifier());
+    EXPECT_EQ(item->property("thickness"), 43.0);
+}
+
+//! Document can't be saved or loaded after one of its models was destroyed.
+
+TEST_F(LazyJsonDocumentTest, destroyedModel)
+{
+    auto file_name = fileName("destroyed.json");
+    auto model = std::make_unique<SessionModel>("TestModel");
+    SessionModel other_model("OtherModel");
+    LazyJsonDocument document({model.get(), &other_model});
+    document.save(file_name);
+
+    model.reset();
+    EXPECT_THROW(document.save(file_name), std::runtime_error);
+    EXPECT_THROW(document.load(file_name), std::runtime_error);
+}
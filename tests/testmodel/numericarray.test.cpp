@@ -0,0 +1,127 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/numericarray.h>
+#include <mvvm/model/propertyitem.h>
+
+using namespace ModelView;
+
+//! Testing NumericArray.
+
+class NumericArrayTest : public ::testing::Test
+{
+public:
+    ~NumericArrayTest();
+};
+
+NumericArrayTest::~NumericArrayTest() = default;
+
+//! Initial state.
+
+TEST_F(NumericArrayTest, initialState)
+{
+    NumericArray array;
+    EXPECT_EQ(array.elementType(), NumericArray::ElementType::FLOAT64);
+    EXPECT_EQ(array.size(), 0u);
+    EXPECT_TRUE(array.empty());
+
+    NumericArray int_array(NumericArray::ElementType::INT32, 3);
+    EXPECT_EQ(int_array.elementType(), NumericArray::ElementType::INT32);
+    EXPECT_EQ(int_array.values<int32_t>(), std::vector<int32_t>({0, 0, 0}));
+    EXPECT_THROW(int_array.values<double>(), std::runtime_error);
+    EXPECT_THROW(int_array.mutableValues<float>(), std::runtime_error);
+}
+
+//! Access to values.
+
+TEST_F(NumericArrayTest, values)
+{
+    NumericArray array(std::vector<float>{0.5f, 1.5f});
+    EXPECT_EQ(array.elementType(), NumericArray::ElementType::FLOAT32);
+    EXPECT_EQ(array.size(), 2u);
+    EXPECT_EQ(array.value(1), 1.5);
+    EXPECT_EQ(array.toDoubles(), std::vector<double>({0.5, 1.5}));
+}
+
+//! Copies share the buffer until modification.
+
+TEST_F(NumericArrayTest, copyOnWrite)
+{
+    NumericArray array(std::vector<double>{1.0, 2.0});
+    const double* buffer = array.values<double>().data();
+
+    NumericArray copy = array;
+    EXPECT_TRUE(copy.isSharedWith(array));
+    EXPECT_EQ(copy.values<double>().data(), buffer);
+    EXPECT_EQ(copy, array);
+
+    copy.mutableValues<double>()[0] = 42.0;
+    EXPECT_FALSE(copy.isSharedWith(array));
+    EXPECT_EQ(array.values<double>().data(), buffer);
+    EXPECT_EQ(array.value(0), 1.0);
+    EXPECT_EQ(copy.value(0), 42.0);
+    EXPECT_NE(copy, array);
+
+    // unique buffer is modified in place
+    copy.mutableValues<double>()[1] = 43.0;
+    EXPECT_EQ(copy.toDoubles(), std::vector<double>({42.0, 43.0}));
+}
+
+//! Moved-from array stays valid and empty.
+
+TEST_F(NumericArrayTest, movedFrom)
+{
+    NumericArray array(std::vector<int32_t>{1, 2});
+    NumericArray moved(std::move(array));
+    EXPECT_EQ(moved.values<int32_t>(), std::vector<int32_t>({1, 2}));
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(array.elementType(), NumericArray::ElementType::FLOAT64);
+
+    array = std::move(moved);
+    EXPECT_EQ(array.size(), 2u);
+    EXPECT_TRUE(moved.empty());
+
+    // empty buffer is detached on modification
+    moved.mutableValues<double>().push_back(42.0);
+    EXPECT_EQ(moved.toDoubles(), std::vector<double>({42.0}));
+    EXPECT_TRUE(NumericArray().empty());
+}
+
+//! Comparison of arrays with different buffers.
+
+TEST_F(NumericArrayTest, comparison)
+{
+    NumericArray array1(std::vector<int32_t>{1, 2});
+    NumericArray array2(std::vector<int32_t>{1, 2});
+    NumericArray array3(std::vector<float>{1.0f, 2.0f});
+
+    EXPECT_EQ(array1, array2);
+    EXPECT_NE(array1, array3);
+    EXPECT_FALSE(array1 < array2);
+    EXPECT_FALSE(array2 < array1);
+}
+
+//! Storing array in the item doesn't copy the buffer.
+
+TEST_F(NumericArrayTest, itemData)
+{
+    NumericArray array(std::vector<float>(1000, 1.0f));
+
+    PropertyItem item;
+    EXPECT_TRUE(item.setData(QVariant::fromValue(array)));
+    EXPECT_TRUE(item.data().value<NumericArray>().isSharedWith(array));
+
+    // setting the same array is not reported as a change
+    EXPECT_FALSE(item.setData(QVariant::fromValue(array)));
+
+    // type of stored variant can't be changed
+    EXPECT_THROW(item.setData(QVariant::fromValue(std::vector<double>{1.0})), std::runtime_error);
+}
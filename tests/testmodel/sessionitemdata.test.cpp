@@ -33,6 +33,20 @@ TEST_F(SessionItemDataTest, initialState)
     EXPECT_FALSE(data.data(Qt::DisplayRole).isValid());
 }
 
+//! Access to stored variant without copying.
+
+TEST_F(SessionItemDataTest, storedData)
+{
+    SessionItemData data;
+    EXPECT_EQ(data.storedData(ItemDataRole::DATA), nullptr);
+
+    data.setData(QVariant(42.0), ItemDataRole::DATA);
+    auto stored = data.storedData(ItemDataRole::DATA);
+    ASSERT_TRUE(stored != nullptr);
+    EXPECT_EQ(*stored, QVariant(42.0));
+    EXPECT_EQ(data.storedData(ItemDataRole::DISPLAY), nullptr);
+}
+
 //! Basic setData, data operations.
 
 TEST_F(SessionItemDataTest, setDataDouble)
@@ -0,0 +1,123 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <limits>
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/viewmodel/cachedchildrenstrategy.h>
+#include <mvvm/viewmodel/standardchildrenstrategies.h>
+
+using namespace ModelView;
+
+//! Tests of CachedChildrenStrategy.
+
+class CachedChildrenStrategyTest : public ::testing::Test
+{
+public:
+    ~CachedChildrenStrategyTest();
+
+    //! Strategy reporting all children and counting its calls.
+    class CountingStrategy : public AllChildrenStrategy
+    {
+    public:
+        CountingStrategy(int& count) : m_count(count) {}
+        std::vector<SessionItem*> children(const SessionItem* item) const override
+        {
+            ++m_count;
+            return AllChildrenStrategy::children(item);
+        }
+
+    private:
+        int& m_count;
+    };
+};
+
+CachedChildrenStrategyTest::~CachedChildrenStrategyTest() = default;
+
+TEST_F(CachedChildrenStrategyTest, cachedChildren)
+{
+    SessionModel model;
+    auto parent = model.insertItem<CompoundItem>();
+    auto x = parent->addProperty("x", 1.0);
+    auto y = parent->addProperty("y", 2.0);
+
+    int count(0);
+    CachedChildrenStrategy strategy(std::make_unique<CountingStrategy>(count));
+
+    EXPECT_EQ(strategy.children(parent), std::vector<SessionItem*>({x, y}));
+    EXPECT_EQ(strategy.childRow(parent, y), 1);
+    EXPECT_EQ(strategy.childRow(parent, parent), -1);
+    EXPECT_EQ(count, 1);
+
+    // items without children are not cached
+    EXPECT_TRUE(strategy.cachedChildren(x).empty());
+    EXPECT_TRUE(strategy.cachedChildren(x).empty());
+    EXPECT_EQ(count, 3);
+}
+
+//! Invalidation of the item removes cached children of the item and its ancestors only.
+
+TEST_F(CachedChildrenStrategyTest, invalidate)
+{
+    SessionModel model;
+    auto parent = model.insertItem<CompoundItem>();
+    auto child = model.insertItem<CompoundItem>(parent);
+    auto x = child->addProperty("x", 1.0);
+
+    int count(0);
+    CachedChildrenStrategy strategy(std::make_unique<CountingStrategy>(count));
+    strategy.cachedChildren(model.rootItem());
+    strategy.cachedChildren(parent);
+    strategy.cachedChildren(child);
+    EXPECT_EQ(count, 3);
+
+    auto y = child->addProperty("y", 2.0);
+    strategy.invalidate(parent);
+    strategy.cachedChildren(model.rootItem());
+    strategy.cachedChildren(parent);
+    EXPECT_EQ(strategy.cachedChildren(child), std::vector<SessionItem*>({x}));
+    EXPECT_EQ(strategy.childRow(child, y), -1);
+    EXPECT_EQ(count, 5);
+
+    strategy.invalidate(child);
+    EXPECT_EQ(strategy.cachedChildren(child), std::vector<SessionItem*>({x, y}));
+    EXPECT_EQ(strategy.childRow(child, y), 1);
+    EXPECT_EQ(count, 6);
+
+    // forgetting the item removes cached children of the item and its descendants
+    strategy.forget(parent);
+    strategy.cachedChildren(model.rootItem());
+    strategy.cachedChildren(parent);
+    strategy.cachedChildren(child);
+    EXPECT_EQ(count, 9);
+}
+
+//! Numeric sort keys go before string keys, NaN goes after other numbers.
+
+TEST_F(CachedChildrenStrategyTest, mixedSortKeys)
+{
+    SessionModel model;
+    auto parent = model.insertItem<CompoundItem>();
+    auto a = parent->addProperty("a", "10");
+    auto b = parent->addProperty("b", 2.0);
+    auto c = parent->addProperty("c", "abc");
+    auto d = parent->addProperty("d", std::numeric_limits<double>::quiet_NaN());
+    auto e = parent->addProperty("e", 1.0);
+    auto f = parent->addProperty("f", "1");
+
+    CachedChildrenStrategy strategy(std::make_unique<AllChildrenStrategy>());
+    auto sort_key = [](const SessionItem* item) { return Utils::toQtVariant(item->data()); };
+    strategy.setSortKey(sort_key);
+    EXPECT_EQ(strategy.children(parent), std::vector<SessionItem*>({e, b, d, f, a, c}));
+
+    strategy.setSortKey(sort_key, Qt::DescendingOrder);
+    EXPECT_EQ(strategy.children(parent), std::vector<SessionItem*>({c, a, f, d, b, e}));
+}
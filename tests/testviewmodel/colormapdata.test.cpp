@@ -0,0 +1,74 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include "qcustomplot.h"
+#include <mvvm/plotting/colormapdata.h>
+#include <vector>
+
+using namespace ModelView;
+
+//! Testing ColorMapData class.
+
+class ColorMapDataTest : public ::testing::Test
+{
+public:
+    ~ColorMapDataTest();
+};
+
+ColorMapDataTest::~ColorMapDataTest() = default;
+
+//! Writing consecutive cells of colormap row.
+
+TEST_F(ColorMapDataTest, setRow)
+{
+    ColorMapData data(3, 2, QCPRange(0.0, 1.0), QCPRange(0.0, 1.0));
+
+    std::vector<double> values = {1.0, 2.0, 3.0};
+    data.setRow(0, 1, values.data(), 3);
+    EXPECT_EQ(data.cell(0, 1), 1.0);
+    EXPECT_EQ(data.cell(1, 1), 2.0);
+    EXPECT_EQ(data.cell(2, 1), 3.0);
+    EXPECT_EQ(data.cell(0, 0), 0.0);
+
+    data.setRow(1, 0, values.data(), 2);
+    EXPECT_EQ(data.cell(0, 0), 0.0);
+    EXPECT_EQ(data.cell(1, 0), 1.0);
+    EXPECT_EQ(data.cell(2, 0), 2.0);
+
+    // data bounds are updated as by setCell
+    data.recalculateDataBounds();
+    auto bounds = data.dataBounds();
+    data.setRow(2, 0, std::vector<double>{-5.0}.data(), 1);
+    EXPECT_EQ(data.dataBounds().lower, -5.0);
+    EXPECT_EQ(data.dataBounds().upper, bounds.upper);
+
+    // cells outside of colormap
+    EXPECT_THROW(data.setRow(1, 0, values.data(), 3), std::runtime_error);
+    EXPECT_THROW(data.setRow(0, 2, values.data(), 1), std::runtime_error);
+}
+
+//! Installing into the colormap keeps cells, the colormap owns the data.
+
+TEST_F(ColorMapDataTest, install)
+{
+    QCustomPlot custom_plot;
+    auto color_map = new QCPColorMap(custom_plot.xAxis, custom_plot.yAxis);
+    color_map->data()->setSize(2, 1);
+    color_map->data()->setCell(1, 0, 42.0);
+
+    auto data = ColorMapData::install(color_map);
+    EXPECT_EQ(color_map->data(), data);
+    EXPECT_EQ(data->keySize(), 2);
+    EXPECT_EQ(data->cell(1, 0), 42.0);
+
+    std::vector<double> values = {1.0, 2.0};
+    data->setRow(0, 0, values.data(), 2);
+    EXPECT_EQ(color_map->data()->cell(1, 0), 2.0);
+}
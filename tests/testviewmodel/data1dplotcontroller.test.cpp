@@ -143,3 +143,73 @@ TEST_F(Data1DPlotControllerTest, twoDataItems)
     EXPECT_EQ(data_item2->binCenters(), TestUtils::binCenters(graph));
     EXPECT_EQ(data_item2->binValues(), TestUtils::binValues(graph));
 }
+
+//! Testing graph points when data is appended to the data item.
+
+TEST_F(Data1DPlotControllerTest, appendContent)
+{
+    auto custom_plot = std::make_unique<QCustomPlot>();
+    auto graph = custom_plot->addGraph();
+
+    SessionModel model;
+    auto data_item = model.insertItem<Data1DItem>();
+    data_item->setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    data_item->setContent(std::vector<double>{1.0, 2.0});
+
+    Data1DPlotController controller(graph);
+    controller.setItem(data_item);
+
+    data_item->appendContent({3.0, 4.0});
+    EXPECT_EQ(graph->dataCount(), 4);
+    EXPECT_EQ(data_item->binCenters(), TestUtils::binCenters(graph));
+    EXPECT_EQ(data_item->binValues(), TestUtils::binValues(graph));
+
+    data_item->appendContent({5.0});
+    EXPECT_EQ(data_item->binCenters(), TestUtils::binCenters(graph));
+    EXPECT_EQ(data_item->binValues(), TestUtils::binValues(graph));
+}
+
+//! Large data is shown as the envelope, which is recalculated on key axis range change.
+
+TEST_F(Data1DPlotControllerTest, decimation)
+{
+    auto custom_plot = std::make_unique<QCustomPlot>();
+    custom_plot->setViewport(QRect(0, 0, 400, 300));
+    auto graph = custom_plot->addGraph();
+
+    SessionModel model;
+    auto data_item = model.insertItem<Data1DItem>();
+    const int nbins = 10000;
+    data_item->setAxis(FixedBinAxisItem::create(nbins, 0.0, nbins));
+    std::vector<double> values(nbins);
+    for (int i = 0; i < nbins; ++i)
+        values[static_cast<size_t>(i)] = (i * 37) % 101;
+    data_item->setContent(values);
+
+    // whole axis is visible, at most four points per pixel column are shown
+    custom_plot->xAxis->setRange(0.0, nbins);
+    Data1DPlotController controller(graph);
+    controller.setItem(data_item);
+
+    EXPECT_LE(graph->dataCount(), 4 * 400 + 2);
+    auto graph_values = TestUtils::binValues(graph);
+    EXPECT_EQ(*std::min_element(graph_values.begin(), graph_values.end()), 0.0);
+    EXPECT_EQ(*std::max_element(graph_values.begin(), graph_values.end()), 100.0);
+
+    // zooming in, all visible points and closest invisible one are shown
+    custom_plot->xAxis->setRange(0.0, 100.0);
+    custom_plot->replot();
+
+    EXPECT_EQ(graph->dataCount(), 102);
+    std::vector<double> expected(values.begin(), values.begin() + 102);
+    EXPECT_EQ(TestUtils::binValues(graph), expected);
+    EXPECT_EQ(TestUtils::binCenters(graph)[101], 101.5);
+
+    // appended points are visible after zooming out
+    data_item->appendContent({1000.0});
+    custom_plot->xAxis->setRange(0.0, nbins + 1);
+    custom_plot->replot();
+
+    graph_values = TestUtils::binValues(graph);
+    EXPECT_EQ(*std::max_element(graph_values.begin(), graph_values.end()), 1000.0);
+}
@@ -200,3 +200,70 @@ TEST_F(Data2DPlotControllerTest, dataRange)
     EXPECT_EQ(range.lower, 1.0);
     EXPECT_EQ(range.upper, 6.0);
 }
+
+//! Testing update of the region of data points.
+
+TEST_F(Data2DPlotControllerTest, dataRegion)
+{
+    auto custom_plot = std::make_unique<QCustomPlot>();
+    auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+
+    SessionModel model;
+    auto data_item = model.insertItem<Data2DItem>();
+    const int nx = 3, ny = 2;
+    data_item->setAxes(FixedBinAxisItem::create(nx, 0.0, 3.0),
+                       FixedBinAxisItem::create(ny, 0.0, 2.0));
+    data_item->setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+
+    Data2DPlotController controller(color_map);
+    controller.setItem(data_item);
+    EXPECT_EQ(color_map->dataRange(), QCPRange(1.0, 6.0));
+
+    data_item->setContentRegion(1, 1, 2, 1, {50.0, 60.0});
+    EXPECT_EQ(color_map->data()->cell(0, 1), 4.0);
+    EXPECT_EQ(color_map->data()->cell(1, 1), 50.0);
+    EXPECT_EQ(color_map->data()->cell(2, 1), 60.0);
+    EXPECT_EQ(color_map->data()->cell(2, 0), 3.0);
+    EXPECT_EQ(color_map->dataRange(), QCPRange(1.0, 60.0));
+}
+
+//! Testing level of detail selection for large data.
+
+TEST_F(Data2DPlotControllerTest, levelOfDetail)
+{
+    auto custom_plot = std::make_unique<QCustomPlot>();
+    custom_plot->setViewport(QRect(0, 0, 400, 300));
+    auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+
+    SessionModel model;
+    auto data_item = model.insertItem<Data2DItem>();
+    const int nx = 4096, ny = 2;
+    data_item->setAxes(FixedBinAxisItem::create(nx, 0.0, nx),
+                       FixedBinAxisItem::create(ny, 0.0, ny));
+    std::vector<double> values(nx * ny);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i % nx;
+    data_item->setContent(values);
+
+    // whole axis is visible, coarse level is shown
+    custom_plot->xAxis->setRange(0.0, nx);
+    Data2DPlotController controller(color_map);
+    controller.setItem(data_item);
+
+    EXPECT_EQ(color_map->data()->keySize(), 512);
+    EXPECT_EQ(color_map->data()->valueSize(), 1);
+    EXPECT_EQ(color_map->data()->cell(0, 0), 3.5); // average of 8x2 bins
+    EXPECT_EQ(color_map->dataRange(), QCPRange(0.0, nx - 1));
+
+    // zooming in, original data is shown in visible range
+    custom_plot->xAxis->setRange(0.0, 256.0);
+    custom_plot->replot();
+
+    EXPECT_EQ(color_map->data()->keySize(), 257);
+    EXPECT_EQ(color_map->data()->valueSize(), ny);
+    EXPECT_EQ(color_map->data()->cell(10, 1), 10.0);
+
+    // region update of shown data
+    data_item->setContentRegion(10, 1, 1, 1, {42.0});
+    EXPECT_EQ(color_map->data()->cell(10, 1), 42.0);
+}
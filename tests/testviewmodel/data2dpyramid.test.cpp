@@ -0,0 +1,78 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <mvvm/plotting/data2dpyramid.h>
+
+using namespace ModelView;
+
+//! Testing Data2DPyramid.
+
+class Data2DPyramidTest : public ::testing::Test
+{
+public:
+    ~Data2DPyramidTest();
+};
+
+Data2DPyramidTest::~Data2DPyramidTest() = default;
+
+//! Initial state.
+
+TEST_F(Data2DPyramidTest, initialState)
+{
+    Data2DPyramid pyramid;
+    EXPECT_EQ(pyramid.levelCount(), 1);
+    EXPECT_EQ(pyramid.levelWidth(0), 0);
+    EXPECT_EQ(pyramid.levelHeight(0), 0);
+}
+
+//! Size of levels.
+
+TEST_F(Data2DPyramidTest, levelSize)
+{
+    Data2DPyramid pyramid;
+    pyramid.reset(5, 2);
+    EXPECT_EQ(pyramid.levelCount(), 4);
+    EXPECT_EQ(pyramid.levelWidth(1), 3);
+    EXPECT_EQ(pyramid.levelHeight(1), 1);
+    EXPECT_EQ(pyramid.levelWidth(2), 2);
+    EXPECT_EQ(pyramid.levelWidth(3), 1);
+    EXPECT_EQ(pyramid.levelHeight(3), 1);
+}
+
+//! Content of levels.
+
+TEST_F(Data2DPyramidTest, levelContent)
+{
+    // 3x2 data
+    const std::vector<double> data = {1.0, 2.0, 3.0, 5.0, 6.0, 7.0};
+
+    Data2DPyramid pyramid;
+    pyramid.reset(3, 2);
+    EXPECT_EQ(&pyramid.level(data, 0), &data);
+    EXPECT_EQ(pyramid.level(data, 1), std::vector<double>({3.5, 5.0}));
+    EXPECT_EQ(pyramid.level(data, 2), std::vector<double>({4.25}));
+    EXPECT_THROW(pyramid.level(data, 3), std::runtime_error);
+}
+
+//! Update of levels after the change of data region.
+
+TEST_F(Data2DPyramidTest, updateRegion)
+{
+    std::vector<double> data(16, 1.0);
+
+    Data2DPyramid pyramid;
+    pyramid.reset(4, 4);
+    EXPECT_EQ(pyramid.level(data, 2), std::vector<double>({1.0}));
+
+    data[15] = 5.0;
+    pyramid.updateRegion(data, 3, 3, 1, 1);
+    EXPECT_EQ(pyramid.level(data, 1), std::vector<double>({1.0, 1.0, 1.0, 2.0}));
+    EXPECT_EQ(pyramid.level(data, 2), std::vector<double>({1.25}));
+}
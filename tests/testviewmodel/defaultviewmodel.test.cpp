@@ -15,8 +15,10 @@
 #include <mvvm/model/taginfo.h>
 #include <mvvm/standarditems/vectoritem.h>
 #include <mvvm/viewmodel/defaultviewmodel.h>
+#include <mvvm/viewmodel/standardviewmodelcontrollers.h>
 #include <mvvm/viewmodel/viewdataitem.h>
 #include <mvvm/viewmodel/viewitems.h>
+#include <mvvm/viewmodel/viewmodelbuilder.h>
 #include <mvvm/viewmodel/viewmodelutils.h>
 
 using namespace ModelView;
@@ -133,6 +135,44 @@ TEST_F(DefaultViewModelTest, indexFromSessionItem)
     EXPECT_EQ(viewModel.indexOfSessionItem(propertyItem), expected);
 }
 
+//! Indices of items are kept up to date on insert and remove of items.
+
+TEST_F(DefaultViewModelTest, indexFromSessionItemAfterInsertRemove)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    auto child0 = model.insertItem<PropertyItem>(parent);
+    auto child1 = model.insertItem<PropertyItem>(parent);
+
+    DefaultViewModel viewModel(&model);
+    auto parentIndex = viewModel.index(0, 0);
+    EXPECT_EQ(viewModel.indexOfSessionItem(child1),
+              QModelIndexList({viewModel.index(1, 0, parentIndex),
+                               viewModel.index(1, 1, parentIndex)}));
+
+    // inserting item in front
+    auto child2 = model.insertItem<PropertyItem>(parent, {"", 0});
+    EXPECT_EQ(viewModel.indexOfSessionItem(child2),
+              QModelIndexList({viewModel.index(0, 0, parentIndex),
+                               viewModel.index(0, 1, parentIndex)}));
+    EXPECT_EQ(viewModel.indexOfSessionItem(child1),
+              QModelIndexList({viewModel.index(2, 0, parentIndex),
+                               viewModel.index(2, 1, parentIndex)}));
+
+    // removing item
+    model.removeItem(parent, {"", 1});
+    EXPECT_TRUE(viewModel.indexOfSessionItem(child0).empty());
+    EXPECT_EQ(viewModel.indexOfSessionItem(child1),
+              QModelIndexList({viewModel.index(1, 0, parentIndex),
+                               viewModel.index(1, 1, parentIndex)}));
+
+    // removing parent together with its children
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_TRUE(viewModel.indexOfSessionItem(child1).empty());
+    EXPECT_TRUE(viewModel.indexOfSessionItem(child2).empty());
+}
+
 //! Find ViewItem's corresponding to given PropertyItem.
 
 TEST_F(DefaultViewModelTest, findPropertyItemView)
@@ -174,6 +214,52 @@ TEST_F(DefaultViewModelTest, propertyItemDataChanged)
     EXPECT_EQ(arguments.at(2).value<QVector<int>>(), expectedRoles);
 }
 
+//! With update interval set, data changes are collected and reported with a single dataChanged
+//! signal for every range of consecutive changed rows.
+
+TEST_F(DefaultViewModelTest, batchedDataChanged)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<PropertyItem>();
+    auto item1 = model.insertItem<PropertyItem>();
+    model.insertItem<PropertyItem>();
+    auto item3 = model.insertItem<PropertyItem>();
+
+    DefaultViewModel viewModel(&model);
+    viewModel.setUpdateInterval(0);
+
+    QSignalSpy spyDataChanged(&viewModel, &DefaultViewModel::dataChanged);
+
+    item0->setData(1.0);
+    item1->setData(2.0);
+    item3->setData(3.0);
+    item0->setData(4.0);
+    EXPECT_EQ(spyDataChanged.count(), 0);
+
+    viewModel.flushDataChanges();
+    ASSERT_EQ(spyDataChanged.count(), 2);
+
+    QList<QVariant> arguments = spyDataChanged.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), viewModel.index(0, 1));
+    EXPECT_EQ(arguments.at(1).value<QModelIndex>(), viewModel.index(1, 1));
+    QVector<int> expectedRoles = {Qt::DisplayRole, Qt::EditRole};
+    EXPECT_EQ(arguments.at(2).value<QVector<int>>(), expectedRoles);
+
+    arguments = spyDataChanged.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), viewModel.index(3, 1));
+    EXPECT_EQ(arguments.at(1).value<QModelIndex>(), viewModel.index(3, 1));
+
+    // collected changes are reported before the removal of rows
+    item3->setData(5.0);
+    model.removeItem(model.rootItem(), {"", 3});
+    EXPECT_EQ(spyDataChanged.count(), 1);
+
+    // switching to immediate reports
+    viewModel.setUpdateInterval(-1);
+    item0->setData(6.0);
+    EXPECT_EQ(spyDataChanged.count(), 2);
+}
+
 //! Inserting single top level item.
 
 TEST_F(DefaultViewModelTest, insertSingleTopItem)
@@ -234,8 +320,7 @@ TEST_F(DefaultViewModelTest, removeSingleTopItem)
     EXPECT_EQ(arguments.at(2).value<int>(), 0);
 }
 
-//! Remove one of two top level items. The pecularity of DefaultViewModel is that it will
-//! remove all children of given parent and then recreate missing.
+//! Remove one of two top level items. Only the row of the removed item is removed.
 
 TEST_F(DefaultViewModelTest, removeOneOfTopItems)
 {
@@ -243,7 +328,7 @@ TEST_F(DefaultViewModelTest, removeOneOfTopItems)
 
     // inserting single item
     model.insertItem<SessionItem>();
-    model.insertItem<SessionItem>();
+    auto item1 = model.insertItem<SessionItem>();
 
     // constructing viewModel from sample model
     DefaultViewModel viewModel(&model);
@@ -262,21 +347,46 @@ TEST_F(DefaultViewModelTest, removeOneOfTopItems)
     EXPECT_EQ(spyRemove.count(), 1);
     EXPECT_EQ(viewModel.rowCount(), 1);
     EXPECT_EQ(viewModel.columnCount(), 2);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(0, 0)), item1);
 
-    // insert was called once to restore missed items
-    EXPECT_EQ(spyInsert.count(), 1);
+    // remaining items are not recreated
+    EXPECT_EQ(spyInsert.count(), 0);
 
     QList<QVariant> arguments = spyRemove.takeFirst();
     EXPECT_EQ(arguments.size(), 3); // QModelIndex &parent, int first, int last
     EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
-    EXPECT_EQ(arguments.at(1).value<int>(), 0); //
-    EXPECT_EQ(arguments.at(2).value<int>(), 1); // two children was removed
+    EXPECT_EQ(arguments.at(1).value<int>(), 0);
+    EXPECT_EQ(arguments.at(2).value<int>(), 0); // one child was removed
+}
 
-    arguments = spyInsert.takeFirst();
-    EXPECT_EQ(arguments.size(), 3); // QModelIndex &parent, int first, int last
+//! Insert item between two top level items. Only the row of the new item is inserted.
+
+TEST_F(DefaultViewModelTest, insertBetweenTopItems)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<SessionItem>();
+    auto item2 = model.insertItem<SessionItem>();
+
+    DefaultViewModel viewModel(&model);
+    auto index0 = viewModel.index(0, 0);
+
+    QSignalSpy spyRemove(&viewModel, &DefaultViewModel::rowsRemoved);
+    QSignalSpy spyInsert(&viewModel, &DefaultViewModel::rowsInserted);
+
+    auto item1 = model.insertItem<SessionItem>(model.rootItem(), {"", 1});
+
+    EXPECT_EQ(spyRemove.count(), 0);
+    ASSERT_EQ(spyInsert.count(), 1);
+    QList<QVariant> arguments = spyInsert.takeFirst();
     EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
-    EXPECT_EQ(arguments.at(1).value<int>(), 0);
-    EXPECT_EQ(arguments.at(2).value<int>(), 0); // one child was inserted back.
+    EXPECT_EQ(arguments.at(1).value<int>(), 1);
+    EXPECT_EQ(arguments.at(2).value<int>(), 1);
+
+    EXPECT_EQ(viewModel.rowCount(), 3);
+    EXPECT_EQ(viewModel.index(0, 0), index0); // existing rows are kept
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(0, 0)), item0);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(1, 0)), item1);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(2, 0)), item2);
 }
 
 //! Single property item in ViewModel with various appearance flags.
@@ -452,3 +562,214 @@ TEST_F(DefaultViewModelTest, onModelDestroyed)
     EXPECT_EQ(viewModel.rowCount(), 0);
     EXPECT_EQ(viewModel.columnCount(), 0);
 }
+
+//! In lazy mode rows of children are constructed on fetchMore request.
+
+TEST_F(DefaultViewModelTest, lazyMode)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    auto child = model.insertItem<SessionItem>(parent);
+    model.insertItem<SessionItem>();
+
+    auto controller = std::make_unique<DefaultViewModelController>();
+    controller->setLazyMode(true);
+    auto viewModel =
+        ViewModelBuilder().setSessionModel(&model).setController(std::move(controller)).build();
+    EXPECT_TRUE(viewModel->isLazyMode());
+
+    // only top level is constructed
+    auto parentIndex = viewModel->index(0, 0);
+    EXPECT_EQ(viewModel->rowCount(), 2);
+    EXPECT_EQ(viewModel->rowCount(parentIndex), 0);
+    EXPECT_TRUE(viewModel->hasChildren(parentIndex));
+    EXPECT_TRUE(viewModel->canFetchMore(parentIndex));
+    EXPECT_FALSE(viewModel->hasChildren(viewModel->index(1, 0)));
+    EXPECT_FALSE(viewModel->canFetchMore(viewModel->index(1, 0)));
+    EXPECT_TRUE(viewModel->indexOfSessionItem(child).empty());
+
+    // inserting into not fetched parent doesn't construct rows
+    model.insertItem<SessionItem>(parent);
+    EXPECT_EQ(viewModel->rowCount(parentIndex), 0);
+
+    viewModel->fetchMore(parentIndex);
+    EXPECT_FALSE(viewModel->canFetchMore(parentIndex));
+    EXPECT_EQ(viewModel->rowCount(parentIndex), 2);
+    EXPECT_EQ(viewModel->indexOfSessionItem(child).size(), 2);
+
+    // inserting into fetched parent
+    model.insertItem<SessionItem>(parent);
+    EXPECT_EQ(viewModel->rowCount(parentIndex), 3);
+
+    // releasing children
+    viewModel->releaseChildren(parentIndex);
+    EXPECT_EQ(viewModel->rowCount(parentIndex), 0);
+    EXPECT_TRUE(viewModel->canFetchMore(parentIndex));
+    EXPECT_TRUE(viewModel->indexOfSessionItem(child).empty());
+
+    viewModel->fetchMore(parentIndex);
+    EXPECT_EQ(viewModel->rowCount(parentIndex), 3);
+}
+
+//! Removal of the item in lazy mode forgets not fetched descendants of the item, so their
+//! addresses can be reused by new items.
+
+TEST_F(DefaultViewModelTest, lazyModeRemoveAndInsert)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    auto child = model.insertItem<SessionItem>(parent);
+    child->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    model.insertItem<SessionItem>(child);
+
+    auto controller = std::make_unique<DefaultViewModelController>();
+    auto controller_ptr = controller.get();
+    controller->setLazyMode(true);
+    auto viewModel =
+        ViewModelBuilder().setSessionModel(&model).setController(std::move(controller)).build();
+
+    viewModel->fetchMore(viewModel->index(0, 0));
+    EXPECT_TRUE(controller_ptr->canFetchMore(child));
+
+    // pointers are only compared, the removed items are not accessed
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_FALSE(controller_ptr->canFetchMore(parent));
+    EXPECT_FALSE(controller_ptr->canFetchMore(child));
+
+    // new item without children is fetched already, so rows of its new children are
+    // constructed on insert
+    auto new_parent = model.insertItem<SessionItem>();
+    new_parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    auto new_child = model.insertItem<SessionItem>(new_parent);
+    EXPECT_FALSE(viewModel->canFetchMore(viewModel->index(0, 0)));
+    EXPECT_EQ(viewModel->rowCount(viewModel->index(0, 0)), 1);
+    EXPECT_EQ(viewModel->indexOfSessionItem(new_child).size(), 2);
+    EXPECT_FALSE(controller_ptr->canFetchMore(new_child));
+}
+
+//! In lazy mode the content of items loaded on demand is loaded on fetchMore request. The
+//! placeholder is replaced with the loaded item, which row gets populated.
+
+TEST_F(DefaultViewModelTest, lazyModeFetchItem)
+{
+    SessionModel model;
+    auto placeholder_id = model.insertItem<SessionItem>()->identifier();
+    auto can_fetch = [&placeholder_id](const SessionItem* item) {
+        return item->identifier() == placeholder_id;
+    };
+    auto fetcher = [&model](SessionItem* item) {
+        auto tagrow = model.rootItem()->tagRowOfItem(item);
+        delete model.rootItem()->takeItem(tagrow);
+        model.insertItem<VectorItem>(model.rootItem(), tagrow);
+    };
+    model.setItemFetcher(can_fetch, fetcher);
+
+    auto controller = std::make_unique<DefaultViewModelController>();
+    controller->setLazyMode(true);
+    auto viewModel =
+        ViewModelBuilder().setSessionModel(&model).setController(std::move(controller)).build();
+
+    // placeholder without children can be fetched
+    EXPECT_TRUE(viewModel->hasChildren(viewModel->index(0, 0)));
+    EXPECT_TRUE(viewModel->canFetchMore(viewModel->index(0, 0)));
+    EXPECT_EQ(viewModel->rowCount(viewModel->index(0, 0)), 0);
+
+    viewModel->fetchMore(viewModel->index(0, 0));
+    auto vector = dynamic_cast<VectorItem*>(model.rootItem()->getItem("", 0));
+    ASSERT_TRUE(vector != nullptr);
+    EXPECT_EQ(viewModel->rowCount(), 1);
+    EXPECT_EQ(viewModel->sessionItemFromIndex(viewModel->index(0, 0)), vector);
+    EXPECT_FALSE(viewModel->canFetchMore(viewModel->index(0, 0)));
+    EXPECT_EQ(viewModel->rowCount(viewModel->index(0, 0)), 3);
+}
+
+//! Construction of top level rows in portions on consecutive event loop iterations.
+
+TEST_F(DefaultViewModelTest, chunkedConstruction)
+{
+    SessionModel model;
+    for (int i = 0; i < 5; ++i)
+        model.insertItem<VectorItem>();
+
+    DefaultViewModel viewModel(&model);
+    QSignalSpy spyProgress(&viewModel, &DefaultViewModel::constructionProgress);
+
+    viewModel.setConstructionChunkSize(2);
+    EXPECT_TRUE(viewModel.isConstructing());
+    EXPECT_EQ(viewModel.rowCount(), 0);
+    EXPECT_EQ(viewModel.columnCount(), 2);
+
+    ASSERT_TRUE(spyProgress.wait());
+    EXPECT_EQ(viewModel.rowCount(), 2);
+    EXPECT_EQ(viewModel.rowCount(viewModel.index(0, 0)), 3);
+
+    // item inserted among constructed rows gets its row immediately
+    auto inserted = model.insertItem<VectorItem>(model.rootItem(), {"", 1});
+    EXPECT_EQ(viewModel.rowCount(), 3);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(1, 0)), inserted);
+
+    // item removed from rows which are not constructed yet
+    model.removeItem(model.rootItem(), {"", 5});
+    EXPECT_EQ(viewModel.rowCount(), 3);
+
+    while (viewModel.isConstructing())
+        ASSERT_TRUE(spyProgress.wait());
+
+    EXPECT_EQ(viewModel.rowCount(), 5);
+    QList<QVariant> arguments = spyProgress.takeLast();
+    EXPECT_EQ(arguments.at(0).toInt(), 5);
+    EXPECT_EQ(arguments.at(1).toInt(), 5);
+
+    auto children = model.rootItem()->children();
+    for (int row = 0; row < viewModel.rowCount(); ++row)
+        EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(row, 0)), children[row]);
+}
+
+//! Sorting and filtering of rows by data of items.
+
+TEST_F(DefaultViewModelTest, sortAndFilter)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<PropertyItem>();
+    item0->setData(3.0);
+    auto item1 = model.insertItem<PropertyItem>();
+    item1->setData(1.0);
+    auto item2 = model.insertItem<PropertyItem>();
+    item2->setData(2.0);
+
+    DefaultViewModel viewModel(&model);
+    auto rows = [&viewModel]() {
+        std::vector<SessionItem*> result;
+        for (int row = 0; row < viewModel.rowCount(); ++row)
+            result.push_back(viewModel.sessionItemFromIndex(viewModel.index(row, 0)));
+        return result;
+    };
+
+    viewModel.setSortKey([](const SessionItem* item) { return item->data(); });
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item1, item2, item0}));
+
+    // data change moves the row to its new position
+    item1->setData(4.0);
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item2, item0, item1}));
+    EXPECT_EQ(viewModel.indexOfSessionItem(item1).at(0), viewModel.index(2, 0));
+
+    // inserted item gets its row at sorted position
+    auto item3 = model.insertItem<PropertyItem>();
+    item3->setData(2.5);
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item2, item3, item0, item1}));
+
+    viewModel.setSortKey([](const SessionItem* item) { return item->data(); },
+                         Qt::DescendingOrder);
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item1, item0, item3, item2}));
+
+    viewModel.setFilter([](const SessionItem* item) { return item->data().toDouble() > 2.0; });
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item1, item0, item3}));
+
+    // items are hidden and shown on data change
+    item0->setData(0.0);
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item1, item3}));
+    item2->setData(5.0);
+    EXPECT_EQ(rows(), std::vector<SessionItem*>({item2, item1, item3}));
+}
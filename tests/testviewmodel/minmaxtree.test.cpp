@@ -0,0 +1,82 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <algorithm>
+#include <mvvm/plotting/minmaxtree.h>
+
+using namespace ModelView;
+
+//! Testing MinMaxTree.
+
+class MinMaxTreeTest : public ::testing::Test
+{
+public:
+    ~MinMaxTreeTest();
+
+    //! Returns indices of minimum and maximum values in the range, as found by the plain search.
+    static std::pair<int, int> expected(const std::vector<double>& data, int first, int last)
+    {
+        auto begin = data.begin() + first;
+        auto end = data.begin() + last + 1;
+        return {static_cast<int>(std::min_element(begin, end) - data.begin()),
+                static_cast<int>(std::max_element(begin, end) - data.begin())};
+    }
+};
+
+MinMaxTreeTest::~MinMaxTreeTest() = default;
+
+//! Initial state.
+
+TEST_F(MinMaxTreeTest, initialState)
+{
+    MinMaxTree tree;
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_THROW(tree.findMinMax({}, 0, 0), std::runtime_error);
+}
+
+//! Search in all possible ranges.
+
+TEST_F(MinMaxTreeTest, findMinMax)
+{
+    std::vector<double> data = {3.0, 1.0, 4.0, 1.0, 5.0, 9.0, 2.0, 6.0, 5.0, 3.0, 5.0};
+    MinMaxTree tree;
+    tree.reset(data);
+    EXPECT_EQ(tree.size(), 11);
+
+    for (int first = 0; first < tree.size(); ++first)
+        for (int last = first; last < tree.size(); ++last)
+            EXPECT_EQ(tree.findMinMax(data, first, last), expected(data, first, last));
+
+    EXPECT_THROW(tree.findMinMax(data, 5, 11), std::runtime_error);
+    EXPECT_THROW(tree.findMinMax(data, 5, 4), std::runtime_error);
+}
+
+//! Appending values within and beyond the capacity of the tree.
+
+TEST_F(MinMaxTreeTest, append)
+{
+    std::vector<double> data = {3.0, 1.0, 4.0};
+    MinMaxTree tree;
+    tree.reset(data);
+
+    data.push_back(-1.0);
+    tree.append(data);
+    EXPECT_EQ(tree.size(), 4);
+    EXPECT_EQ(tree.findMinMax(data, 0, 3), std::make_pair(3, 2));
+
+    data.insert(data.end(), {10.0, 0.0, 2.0});
+    tree.append(data);
+    EXPECT_EQ(tree.size(), 7);
+    for (int first = 0; first < tree.size(); ++first)
+        for (int last = first; last < tree.size(); ++last)
+            EXPECT_EQ(tree.findMinMax(data, first, last), expected(data, first, last));
+
+    EXPECT_THROW(tree.append({1.0}), std::runtime_error);
+}
@@ -0,0 +1,165 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QSignalSpy>
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/model/taginfo.h>
+#include <mvvm/viewmodel/refviewitem.h>
+#include <mvvm/viewmodel/refviewmodel.h>
+#include <mvvm/viewmodel/standardviewmodelcontrollers.h>
+#include <mvvm/viewmodel/standardviewmodels.h>
+
+using namespace ModelView;
+
+//! Tests for RefViewModelController class, with RefViewModel representing SessionModel.
+
+class RefViewModelControllerTest : public ::testing::Test
+{
+public:
+    ~RefViewModelControllerTest();
+};
+
+RefViewModelControllerTest::~RefViewModelControllerTest() = default;
+
+TEST_F(RefViewModelControllerTest, initialState)
+{
+    SessionModel model;
+    auto viewmodel = Utils::CreateRefDefaultViewModel(&model);
+    EXPECT_EQ(viewmodel->rowCount(), 0);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(QModelIndex()), model.rootItem());
+    EXPECT_EQ(viewmodel->headerData(0, Qt::Horizontal).toString(), QString("Name"));
+    EXPECT_EQ(viewmodel->headerData(1, Qt::Horizontal).toString(), QString("Value"));
+}
+
+//! Single property item in a model.
+
+TEST_F(RefViewModelControllerTest, fromPropertyItem)
+{
+    SessionModel model;
+    auto property = model.insertItem<PropertyItem>();
+    property->setDisplayName("thickness");
+    property->setData(42.0);
+
+    auto viewmodel = Utils::CreateRefDefaultViewModel(&model);
+    EXPECT_EQ(viewmodel->rowCount(), 1);
+    EXPECT_EQ(viewmodel->columnCount(), 2);
+
+    auto label_index = viewmodel->index(0, 0);
+    auto data_index = viewmodel->index(0, 1);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(label_index), property);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(data_index), property);
+    EXPECT_EQ(viewmodel->indexOfSessionItem(property), QModelIndexList({label_index, data_index}));
+
+    EXPECT_EQ(viewmodel->data(label_index).toString(), QString("thickness"));
+    EXPECT_EQ(viewmodel->data(data_index).toDouble(), 42.0);
+    EXPECT_FALSE(viewmodel->flags(label_index) & Qt::ItemIsEditable);
+    EXPECT_TRUE(viewmodel->flags(data_index) & Qt::ItemIsEditable);
+
+    // editing through the view model
+    QSignalSpy spy_data_changed(viewmodel.get(), &RefViewModel::dataChanged);
+    EXPECT_TRUE(viewmodel->setData(data_index, 43.0, Qt::EditRole));
+    EXPECT_EQ(property->data().value<double>(), 43.0);
+    ASSERT_EQ(spy_data_changed.count(), 1);
+    QList<QVariant> arguments = spy_data_changed.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), data_index);
+    EXPECT_EQ(arguments.at(1).value<QModelIndex>(), data_index);
+}
+
+//! Insert and remove of items lead to insert and remove of single rows.
+
+TEST_F(RefViewModelControllerTest, insertRemoveItems)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    auto child0 = model.insertItem<PropertyItem>(parent);
+    auto child2 = model.insertItem<PropertyItem>(parent);
+
+    auto viewmodel = Utils::CreateRefDefaultViewModel(&model);
+    auto parent_index = viewmodel->index(0, 0);
+    EXPECT_EQ(viewmodel->rowCount(parent_index), 2);
+
+    QSignalSpy spy_insert(viewmodel.get(), &RefViewModel::rowsInserted);
+    QSignalSpy spy_remove(viewmodel.get(), &RefViewModel::rowsRemoved);
+
+    auto child1 = model.insertItem<PropertyItem>(parent, {"", 1});
+    EXPECT_EQ(spy_remove.count(), 0);
+    ASSERT_EQ(spy_insert.count(), 1);
+    QList<QVariant> arguments = spy_insert.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), parent_index);
+    EXPECT_EQ(arguments.at(1).value<int>(), 1);
+    EXPECT_EQ(arguments.at(2).value<int>(), 1);
+
+    EXPECT_EQ(viewmodel->rowCount(parent_index), 3);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(viewmodel->index(0, 0, parent_index)), child0);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(viewmodel->index(1, 0, parent_index)), child1);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(viewmodel->index(2, 0, parent_index)), child2);
+
+    model.removeItem(parent, {"", 0});
+    EXPECT_EQ(spy_insert.count(), 0);
+    ASSERT_EQ(spy_remove.count(), 1);
+    arguments = spy_remove.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), parent_index);
+    EXPECT_EQ(arguments.at(1).value<int>(), 0);
+    EXPECT_EQ(arguments.at(2).value<int>(), 0);
+
+    EXPECT_EQ(viewmodel->rowCount(parent_index), 2);
+    EXPECT_TRUE(viewmodel->indexOfSessionItem(child0).empty());
+    EXPECT_EQ(viewmodel->indexOfSessionItem(child2).at(0), viewmodel->index(1, 0, parent_index));
+
+    // removing parent with its children
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(viewmodel->rowCount(), 0);
+    EXPECT_TRUE(viewmodel->indexOfSessionItem(child2).empty());
+}
+
+//! Table of properties has the same layout as PropertyTableViewModel.
+
+TEST_F(RefViewModelControllerTest, propertyTable)
+{
+    SessionModel model;
+    for (int i = 0; i < 3; ++i) {
+        auto item = model.insertItem<CompoundItem>();
+        item->addProperty("a", 1.0 * i);
+        item->addProperty("b", 2.0 * i);
+    }
+
+    auto viewmodel = Utils::CreateRefPropertyTableViewModel(&model);
+    EXPECT_EQ(viewmodel->rowCount(), 3);
+    EXPECT_EQ(viewmodel->columnCount(), 2);
+    EXPECT_EQ(viewmodel->headerData(1, Qt::Horizontal).toString(), QString("b"));
+    EXPECT_EQ(viewmodel->data(viewmodel->index(2, 1)).toDouble(), 4.0);
+
+    model.removeItem(model.rootItem(), {"", 1});
+    EXPECT_EQ(viewmodel->rowCount(), 2);
+    EXPECT_EQ(viewmodel->data(viewmodel->index(1, 1)).toDouble(), 4.0);
+}
+
+//! View model is cleared when SessionModel is cleared.
+
+TEST_F(RefViewModelControllerTest, onModelReset)
+{
+    SessionModel model;
+    model.insertItem<SessionItem>();
+    model.insertItem<SessionItem>();
+
+    auto viewmodel = Utils::CreateRefDefaultViewModel(&model);
+    EXPECT_EQ(viewmodel->rowCount(), 2);
+
+    model.clear();
+    EXPECT_EQ(viewmodel->rowCount(), 0);
+
+    // items of the new root are shown
+    auto item = model.insertItem<SessionItem>();
+    EXPECT_EQ(viewmodel->rowCount(), 1);
+    EXPECT_EQ(viewmodel->sessionItemFromIndex(viewmodel->index(0, 0)), item);
+}
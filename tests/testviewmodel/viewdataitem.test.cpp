@@ -11,6 +11,8 @@
 #include <QDebug>
 #include <memory>
 #include <mvvm/model/sessionitem.h>
+#include <mvvm/standarditems/axisitems.h>
+#include <mvvm/standarditems/data1ditem.h>
 #include <mvvm/viewmodel/viewdataitem.h>
 
 using namespace ModelView;
@@ -48,6 +50,21 @@ TEST_F(ViewDataItemTest, dataForDouble)
     EXPECT_EQ(viewItem.data(Qt::DisplayRole), expected);
 }
 
+//! ViewDataItem::data method for string values. Converted string is updated on data change.
+
+TEST_F(ViewDataItemTest, dataForString)
+{
+    auto item = std::make_unique<SessionItem>();
+    EXPECT_TRUE(item->setData(QVariant::fromValue(std::string("abc"))));
+
+    ViewDataItem viewItem(item.get());
+    EXPECT_EQ(viewItem.data(Qt::DisplayRole), QVariant(QString("abc")));
+    EXPECT_EQ(viewItem.data(Qt::EditRole), QVariant(QString("abc")));
+
+    EXPECT_TRUE(item->setData(QVariant::fromValue(std::string("def"))));
+    EXPECT_EQ(viewItem.data(Qt::DisplayRole), QVariant(QString("def")));
+}
+
 //! ViewDataItem::setData for double values.
 //! Checks that the setData method is correctly forwarded to underlying SessionItem.
 
@@ -114,3 +131,21 @@ TEST_F(ViewDataItemTest, setDataForColor)
     QVariant not_allowed_value("Layer");
     EXPECT_THROW(viewItem.setData(not_allowed_value, Qt::EditRole), std::runtime_error);
 }
+
+//! ViewDataItem doesn't keep a copy of data, which isn't converted for Qt. Large content can be
+//! modified in place after it was displayed.
+
+TEST_F(ViewDataItemTest, dataForNumericArray)
+{
+    Data1DItem item;
+    item.setAxis(FixedBinAxisItem::create(2, 0.0, 2.0));
+    item.setContent(std::vector<double>{1.0, 2.0});
+    const double* buffer = item.binValuesRef().data();
+
+    ViewDataItem viewItem(&item);
+    EXPECT_EQ(viewItem.data(Qt::DisplayRole), item.data());
+
+    item.updateContent([](std::vector<double>& values) { values[0] = 10.0; });
+    EXPECT_EQ(item.binValuesRef().data(), buffer);
+    EXPECT_EQ(viewItem.data(Qt::DisplayRole), item.data());
+}
@@ -0,0 +1,184 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QSignalSpy>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/model/taginfo.h>
+#include <mvvm/standarditems/vectoritem.h>
+#include <mvvm/viewmodel/virtualtableviewmodel.h>
+
+using namespace ModelView;
+
+//! Tests of VirtualTableViewModel.
+
+class VirtualTableViewModelTest : public ::testing::Test
+{
+public:
+    ~VirtualTableViewModelTest();
+};
+
+VirtualTableViewModelTest::~VirtualTableViewModelTest() = default;
+
+TEST_F(VirtualTableViewModelTest, initialState)
+{
+    SessionModel model;
+    VirtualTableViewModel viewModel(&model);
+    EXPECT_EQ(viewModel.rowCount(), 0);
+    EXPECT_EQ(viewModel.columnCount(), 0);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(QModelIndex()), nullptr);
+}
+
+//! Two VectorItems in a model.
+
+TEST_F(VirtualTableViewModelTest, vectorItems)
+{
+    SessionModel model;
+    auto vector0 = model.insertItem<VectorItem>();
+    auto vector1 = model.insertItem<VectorItem>();
+    vector1->setProperty(VectorItem::P_Y, 42.0);
+
+    VirtualTableViewModel viewModel(&model);
+    EXPECT_EQ(viewModel.rowCount(), 2);
+    EXPECT_EQ(viewModel.columnCount(), 3);
+    EXPECT_EQ(viewModel.headerData(1, Qt::Horizontal).toString(), QString("Y"));
+
+    auto index = viewModel.index(1, 1);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(index), vector1->getItem(VectorItem::P_Y));
+    EXPECT_EQ(viewModel.indexOfSessionItem(vector1->getItem(VectorItem::P_Y)), index);
+    EXPECT_EQ(viewModel.data(index).toDouble(), 42.0);
+    EXPECT_TRUE(viewModel.flags(index) & Qt::ItemIsEditable);
+    EXPECT_EQ(viewModel.indexOfSessionItem(vector0), QModelIndex());
+
+    // column tags defined by the user
+    viewModel.setColumnTags({VectorItem::P_Z, VectorItem::P_Y});
+    EXPECT_EQ(viewModel.columnCount(), 2);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(0, 0)),
+              vector0->getItem(VectorItem::P_Z));
+}
+
+//! Changing data through the view model.
+
+TEST_F(VirtualTableViewModelTest, setData)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    VirtualTableViewModel viewModel(&model);
+
+    EXPECT_TRUE(viewModel.setData(viewModel.index(0, 2), 43.0, Qt::EditRole));
+    EXPECT_EQ(vector->property<double>(VectorItem::P_Z), 43.0);
+}
+
+//! Data changes are reported with a single dataChanged signal covering all changed cells.
+
+TEST_F(VirtualTableViewModelTest, batchedDataChanged)
+{
+    SessionModel model;
+    auto vector0 = model.insertItem<VectorItem>();
+    model.insertItem<VectorItem>();
+    auto vector2 = model.insertItem<VectorItem>();
+    VirtualTableViewModel viewModel(&model);
+
+    QSignalSpy spyDataChanged(&viewModel, &VirtualTableViewModel::dataChanged);
+
+    vector0->setProperty(VectorItem::P_Y, 1.0);
+    vector2->setProperty(VectorItem::P_X, 2.0);
+    vector2->setProperty(VectorItem::P_Y, 3.0);
+    EXPECT_EQ(spyDataChanged.count(), 0);
+
+    viewModel.flushDataChanges();
+    ASSERT_EQ(spyDataChanged.count(), 1);
+    QList<QVariant> arguments = spyDataChanged.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), viewModel.index(0, 0));
+    EXPECT_EQ(arguments.at(1).value<QModelIndex>(), viewModel.index(2, 1));
+
+    // nothing left to report
+    viewModel.flushDataChanges();
+    EXPECT_EQ(spyDataChanged.count(), 0);
+}
+
+//! Insertion and removal of rows.
+
+TEST_F(VirtualTableViewModelTest, insertRemoveRows)
+{
+    SessionModel model;
+    model.insertItem<VectorItem>();
+    auto vector1 = model.insertItem<VectorItem>();
+    VirtualTableViewModel viewModel(&model);
+
+    QSignalSpy spyInsert(&viewModel, &VirtualTableViewModel::rowsInserted);
+    QSignalSpy spyRemove(&viewModel, &VirtualTableViewModel::rowsRemoved);
+
+    auto inserted = model.insertItem<VectorItem>(model.rootItem(), {"", 1});
+    EXPECT_EQ(viewModel.rowCount(), 3);
+    ASSERT_EQ(spyInsert.count(), 1);
+    EXPECT_EQ(spyInsert.takeFirst().at(1).toInt(), 1);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(1, 0)),
+              inserted->getItem(VectorItem::P_X));
+    EXPECT_EQ(viewModel.indexOfSessionItem(vector1->getItem(VectorItem::P_X)),
+              viewModel.index(2, 0));
+
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(viewModel.rowCount(), 2);
+    ASSERT_EQ(spyRemove.count(), 1);
+    EXPECT_EQ(spyRemove.takeFirst().at(1).toInt(), 0);
+    EXPECT_EQ(viewModel.indexOfSessionItem(vector1->getItem(VectorItem::P_X)),
+              viewModel.index(1, 0));
+}
+
+//! Rows are found from neighbours in the same tag, or from top level items of preceding tags.
+
+TEST_F(VirtualTableViewModelTest, insertRowsIntoSeveralTags)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag1"));
+    parent->registerTag(TagInfo::universalTag("tag2"));
+    auto vector0 = model.insertItem<VectorItem>(parent, {"tag1", 0});
+    VirtualTableViewModel viewModel(&model);
+    viewModel.setRootSessionItem(parent);
+    EXPECT_EQ(viewModel.rowCount(), 1);
+
+    // first item of the second tag
+    auto vector1 = model.insertItem<VectorItem>(parent, {"tag2", 0});
+    // in front of the first item of the tag
+    auto vector2 = model.insertItem<VectorItem>(parent, {"tag1", 0});
+    // after the last item of the tag
+    auto vector3 = model.insertItem<VectorItem>(parent, {"tag1", 2});
+
+    ASSERT_EQ(viewModel.rowCount(), 4);
+    std::vector<SessionItem*> expected = {vector2, vector0, vector3, vector1};
+    for (int row = 0; row < 4; ++row)
+        EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(row, 0)),
+                  expected[static_cast<size_t>(row)]->getItem(VectorItem::P_X));
+}
+
+//! Clearing the model removes all rows, items of the new root are shown.
+
+TEST_F(VirtualTableViewModelTest, clearModel)
+{
+    SessionModel model;
+    model.insertItem<VectorItem>();
+    model.insertItem<VectorItem>();
+    VirtualTableViewModel viewModel(&model);
+    EXPECT_EQ(viewModel.rowCount(), 2);
+
+    QSignalSpy spyReset(&viewModel, &VirtualTableViewModel::modelReset);
+    model.clear();
+    EXPECT_EQ(spyReset.count(), 1);
+    EXPECT_EQ(viewModel.rowCount(), 0);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(0, 0)), nullptr);
+
+    auto vector = model.insertItem<VectorItem>();
+    EXPECT_EQ(viewModel.rowCount(), 1);
+    EXPECT_EQ(viewModel.columnCount(), 3);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(0, 0)),
+              vector->getItem(VectorItem::P_X));
+}